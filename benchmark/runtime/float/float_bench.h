@@ -56,11 +56,14 @@ inline long double generate_single_float()
 }
 
 template <typename Float>
-std::vector<std::string> make_float_list(std::size_t n)
+std::vector<std::string> make_float_list(std::size_t n, int precision = 0)
 {
     std::vector<std::string> result{};
     for (size_t i = 0; i < n; ++i) {
         std::ostringstream oss;
+        if (precision != 0) {
+            oss.precision(precision);
+        }
         oss << generate_single_float<Float>();
         result.push_back(SCN_MOVE(oss.str()));
     }
@@ -74,6 +77,15 @@ const auto& get_float_list()
     return list;
 }
 
+// Enough digits to round-trip: doesn't fit the short-input fast paths
+template <typename Float>
+const auto& get_float_list_full_precision()
+{
+    static auto list = make_float_list<Float>(
+        2 << 12, std::numeric_limits<Float>::max_digits10);
+    return list;
+}
+
 template <typename Float>
 std::string make_float_string(std::size_t n)
 {
@@ -69,6 +69,27 @@ BENCHMARK_TEMPLATE(scan_float_single_scn_value, float);
 BENCHMARK_TEMPLATE(scan_float_single_scn_value, double);
 BENCHMARK_TEMPLATE(scan_float_single_scn_value, long double);
 
+template <typename Float>
+static void scan_float_single_scn_value_full_precision(benchmark::State& state)
+{
+    single_state<Float> s{get_float_list_full_precision<Float>()};
+
+    for (auto _ : state) {
+        s.reset_if_necessary();
+
+        if (auto result = scn::scan_value<Float>(*s.it); !result) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            s.push(result->value());
+        }
+    }
+    state.SetBytesProcessed(s.get_bytes_processed(state));
+}
+BENCHMARK_TEMPLATE(scan_float_single_scn_value_full_precision, double);
+BENCHMARK_TEMPLATE(scan_float_single_scn_value_full_precision, long double);
+
 template <typename Float>
 static void scan_float_single_sstream(benchmark::State& state)
 {
@@ -137,6 +158,27 @@ BENCHMARK_TEMPLATE(scan_float_single_strtod, float);
 BENCHMARK_TEMPLATE(scan_float_single_strtod, double);
 BENCHMARK_TEMPLATE(scan_float_single_strtod, long double);
 
+template <typename Float>
+static void scan_float_single_strtod_full_precision(benchmark::State& state)
+{
+    single_state<Float> s{get_float_list_full_precision<Float>()};
+
+    for (auto _ : state) {
+        s.reset_if_necessary();
+
+        Float f{};
+        auto ret = strtod_float(s.it->c_str(), f);
+        if (!ret) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        s.push(f);
+    }
+    state.SetBytesProcessed(s.get_bytes_processed(state));
+}
+BENCHMARK_TEMPLATE(scan_float_single_strtod_full_precision, double);
+BENCHMARK_TEMPLATE(scan_float_single_strtod_full_precision, long double);
+
 #if SCN_HAS_FLOAT_CHARCONV
 
 template <typename Float>
@@ -64,6 +64,51 @@ const std::string& get_integer_string()
     return str;
 }
 
+// Random non-negative integers with exactly `digits` decimal digits,
+// clamped to the range of `Int`
+template <typename Int>
+std::uniform_int_distribution<Int> make_integer_digits_distribution(
+    int digits)
+{
+    auto lo = uint64_t{1};
+    for (int i = 1; i < digits; ++i) {
+        lo *= 10;
+    }
+    const auto max = static_cast<uint64_t>(std::numeric_limits<Int>::max());
+    const auto hi = (digits >= 20 || lo > max / 10) ? max : lo * 10 - 1;
+    return std::uniform_int_distribution<Int>(static_cast<Int>(lo),
+                                              static_cast<Int>(hi));
+}
+
+template <typename Int>
+const std::vector<std::string>& get_integer_list_with_digits(int digits)
+{
+    static std::vector<std::string> lists[21]{};
+    auto& list = lists[digits];
+    if (list.empty()) {
+        auto dist = make_integer_digits_distribution<Int>(digits);
+        for (size_t i = 0; i < (2 << 12); ++i) {
+            list.push_back(std::to_string(dist(get_rng())));
+        }
+    }
+    return list;
+}
+
+template <typename Int>
+const std::string& get_integer_string_with_digits(int digits)
+{
+    static std::string strings[21]{};
+    auto& str = strings[digits];
+    if (str.empty()) {
+        auto dist = make_integer_digits_distribution<Int>(digits);
+        for (size_t i = 0; i < (2 << 12); ++i) {
+            str += std::to_string(dist(get_rng()));
+            str += ' ';
+        }
+    }
+    return str;
+}
+
 inline int sscanf_integral(const char* ptr, int& i)
 {
     return std::sscanf(ptr, "%d", &i);
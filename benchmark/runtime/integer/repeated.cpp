@@ -81,6 +81,40 @@ BENCHMARK_TEMPLATE(scan_int_repeated_scn_value, int);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_value, long long);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_value, unsigned);
 
+template <typename Int>
+static void scan_int_repeated_scn_value_digits(benchmark::State& state)
+{
+    repeated_state<Int> s{
+        get_integer_string_with_digits<Int>(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        auto result = scn::scan_value<Int>(s.view());
+
+        if (!result) {
+            if (result.error() == scn::scan_error::end_of_range) {
+                s.reset();
+            }
+            else {
+                state.SkipWithError("Scan error");
+                break;
+            }
+        }
+        else {
+            s.push(result->value());
+            s.it = scn::detail::to_address(result->range().begin());
+        }
+    }
+    state.SetBytesProcessed(s.get_bytes_processed(state));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_value_digits, long long)
+    ->Arg(10)
+    ->Arg(16)
+    ->Arg(19);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_value_digits, unsigned long long)
+    ->Arg(10)
+    ->Arg(16)
+    ->Arg(19);
+
 template <typename Int>
 static void scan_int_repeated_scn_decimal(benchmark::State& state)
 {
@@ -141,6 +175,55 @@ BENCHMARK_TEMPLATE(scan_int_repeated_scn_int, int);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_int, long long);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn_int, unsigned);
 
+template <typename Int>
+static void scan_int_repeated_scn_all(benchmark::State& state)
+{
+    const auto& source = get_integer_string<Int>();
+    std::vector<Int> values;
+    int64_t count = 0;
+
+    for (auto _ : state) {
+        values.clear();
+        auto result = scn::scan_all<Int>(source, "{}", values);
+
+        if (!result.error) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        count += static_cast<int64_t>(result.count);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(count * static_cast<int64_t>(sizeof(Int)));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_all, int);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_all, long long);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_all, unsigned);
+
+template <typename Int>
+static void scan_int_repeated_scn_int_array(benchmark::State& state)
+{
+    const auto& source = get_integer_string<Int>();
+    std::vector<Int> values;
+    int64_t count = 0;
+
+    for (auto _ : state) {
+        values.clear();
+        auto result = scn::scan_int_array<Int>(source, ' ',
+                                               std::back_inserter(values));
+
+        if (!result.error) {
+            state.SkipWithError("Scan error");
+            break;
+        }
+        count += static_cast<int64_t>(result.count);
+        benchmark::DoNotOptimize(values.data());
+    }
+    state.SetBytesProcessed(count * static_cast<int64_t>(sizeof(Int)));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_int_array, int);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_int_array, long long);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_int_array, unsigned);
+
 template <typename Int>
 static void scan_int_repeated_sstream(benchmark::State& state)
 {
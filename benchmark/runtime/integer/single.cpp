@@ -133,6 +133,34 @@ BENCHMARK_TEMPLATE(scan_int_single_scn_int_exhaustive_valid, long long);
 BENCHMARK_TEMPLATE(scan_int_single_scn_int_exhaustive_valid, unsigned);
 #endif
 
+template <typename Int>
+static void scan_int_single_scn_value_digits(benchmark::State& state)
+{
+    single_state<Int> s{
+        get_integer_list_with_digits<Int>(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        s.reset_if_necessary();
+
+        if (auto result = scn::scan_value<Int>(*s.it); !result) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        else {
+            s.push(result->value());
+        }
+    }
+    state.SetBytesProcessed(s.get_bytes_processed(state));
+}
+BENCHMARK_TEMPLATE(scan_int_single_scn_value_digits, long long)
+    ->Arg(10)
+    ->Arg(16)
+    ->Arg(19);
+BENCHMARK_TEMPLATE(scan_int_single_scn_value_digits, unsigned long long)
+    ->Arg(10)
+    ->Arg(16)
+    ->Arg(19);
+
 template <typename Int>
 static void scan_int_single_sstream(benchmark::State& state)
 {
@@ -226,6 +254,35 @@ BENCHMARK_TEMPLATE(scan_int_single_charconv, int);
 BENCHMARK_TEMPLATE(scan_int_single_charconv, long long);
 BENCHMARK_TEMPLATE(scan_int_single_charconv, unsigned);
 
+template <typename Int>
+static void scan_int_single_charconv_digits(benchmark::State& state)
+{
+    single_state<Int> s{
+        get_integer_list_with_digits<Int>(static_cast<int>(state.range(0)))};
+
+    for (auto _ : state) {
+        s.reset_if_necessary();
+
+        Int i{};
+        auto ret =
+            std::from_chars(s.it->data(), s.it->data() + s.it->size(), i);
+        if (ret.ec != std::errc{}) {
+            state.SkipWithError("Benchmark errored");
+            break;
+        }
+        s.push(i);
+    }
+    state.SetBytesProcessed(s.get_bytes_processed(state));
+}
+BENCHMARK_TEMPLATE(scan_int_single_charconv_digits, long long)
+    ->Arg(10)
+    ->Arg(16)
+    ->Arg(19);
+BENCHMARK_TEMPLATE(scan_int_single_charconv_digits, unsigned long long)
+    ->Arg(10)
+    ->Arg(16)
+    ->Arg(19);
+
 #endif  // SCN_HAS_INTEGER_CHARCONV
 
 template <typename Int>
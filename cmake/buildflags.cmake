@@ -37,6 +37,8 @@ function(get_config_flags flags)
 
             $<$<BOOL:${SCN_DISABLE_FROM_CHARS}>: -DSCN_DISABLE_FROM_CHARS=1>
             $<$<BOOL:${SCN_DISABLE_STRTOD}>: -DSCN_DISABLE_STRTOD=1>
+            $<$<BOOL:${SCN_DISABLE_SIMD}>: -DSCN_DISABLE_SIMD=1>
+            $<$<BOOL:${SCN_DISABLE_THREADS}>: -DSCN_DISABLE_THREADS=1>
 
             $<$<BOOL:${SCN_DISABLE_IOSTREAM}>: -DSCN_DISABLE_IOSTREAM=1>
             $<$<BOOL:${SCN_DISABLE_LOCALE}>: -DSCN_DISABLE_LOCALE=1>
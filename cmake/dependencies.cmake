@@ -178,6 +178,14 @@ if (SCN_REGEX_BACKEND STREQUAL "re2")
     set(SCN_REGEX_BACKEND_TARGET re2::re2)
 endif ()
 
+# Threads
+
+if (NOT SCN_DISABLE_THREADS)
+    if (NOT TARGET Threads::Threads)
+        find_package(Threads REQUIRED)
+    endif ()
+endif ()
+
 # make available
 
 FetchContent_MakeAvailable(
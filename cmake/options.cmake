@@ -76,3 +76,5 @@ option(SCN_DISABLE_LOCALE "Disable all localization" OFF)
 
 option(SCN_DISABLE_FROM_CHARS "Disallow falling back on std::from_chars when scanning floating-point values" OFF)
 option(SCN_DISABLE_STRTOD "Disallow falling back on std::strtod when scanning floating-point values" OFF)
+option(SCN_DISABLE_SIMD "Disable the use of SIMD instructions, even if available on the target" OFF)
+option(SCN_DISABLE_THREADS "Disable everything requiring threads (read-ahead file buffer)" OFF)
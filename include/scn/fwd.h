@@ -128,6 +128,20 @@
 #define SCN_DISABLE_STRTOD 0
 #endif
 
+// SCN_DISABLE_SIMD
+// If 1, disables the use of SIMD instructions (SSE2, AVX2) in the library,
+// even if they'd be available on the target
+#ifndef SCN_DISABLE_SIMD
+#define SCN_DISABLE_SIMD 0
+#endif
+
+// SCN_DISABLE_THREADS
+// If 1, removes everything requiring threads
+// (the read-ahead file buffer, scan_readahead_file_buffer)
+#ifndef SCN_DISABLE_THREADS
+#define SCN_DISABLE_THREADS 0
+#endif
+
 // SCN_DISABLE_TYPE_*
 // If 1, removes ability to scan type
 #ifndef SCN_DISABLE_TYPE_SCHAR
@@ -666,6 +680,14 @@ SCN_GCC_POP
 #define SCN_HAS_BITOPS 0
 #endif
 
+// Detect <memory_resource>
+#if SCN_STD >= SCN_STD_17 && SCN_HAS_INCLUDE(<memory_resource>) && \
+    (!SCN_STDLIB_LIBCPP || SCN_STDLIB_LIBCPP >= 16000)
+#define SCN_HAS_MEMORY_RESOURCE 1
+#else
+#define SCN_HAS_MEMORY_RESOURCE 0
+#endif
+
 // Detect __assume
 #if SCN_INTEL || SCN_MSVC
 #define SCN_HAS_ASSUME 1
@@ -995,6 +1017,14 @@ using wscan_format_string =
                              detail::type_identity_t<Source>,
                              detail::type_identity_t<Args>...>;
 
+template <typename CharT, typename... Args>
+class basic_compiled_format;
+
+template <typename... Args>
+using compiled_format = basic_compiled_format<char, Args...>;
+template <typename... Args>
+using wcompiled_format = basic_compiled_format<wchar_t, Args...>;
+
 struct invalid_input_range;
 
 #if !SCN_DISABLE_IOSTREAM
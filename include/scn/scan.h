@@ -23,6 +23,7 @@
 #include <array>
 #include <cstdio>
 #include <cstring>
+#include <forward_list>
 #include <iterator>
 #include <limits>
 #include <optional>
@@ -30,6 +31,15 @@
 #include <string_view>
 #include <tuple>
 
+#if SCN_HAS_STD_SPAN
+#include <span>
+#endif
+
+#if SCN_HAS_MEMORY_RESOURCE
+#include <memory>
+#include <memory_resource>
+#endif
+
 /////////////////////////////////////////////////////////////////
 // <expected> implementation
 /////////////////////////////////////////////////////////////////
@@ -4057,6 +4067,16 @@ inline constexpr bool is_cp_space(char32_t cp) noexcept
 /////////////////////////////////////////////////////////////////
 
 namespace detail {
+#if SCN_HAS_MEMORY_RESOURCE
+// String type used for storage internal to the library,
+// allocated from the memory resource of the scan buffer it's related to
+template <typename CharT>
+using internal_string = std::pmr::basic_string<CharT>;
+#else
+template <typename CharT>
+using internal_string = std::basic_string<CharT>;
+#endif
+
 template <typename CharT>
 class basic_scan_buffer {
 public:
@@ -4086,7 +4106,8 @@ public:
 
     SCN_NODISCARD std::ptrdiff_t chars_available() const
     {
-        return m_putback_buffer.size() + m_current_view.size();
+        return m_putback_offset + m_putback_view.size() +
+               m_current_view.size();
     }
 
     SCN_NODISCARD std::basic_string_view<CharT> current_view() const
@@ -4094,34 +4115,106 @@ public:
         return m_current_view;
     }
 
-    SCN_NODISCARD std::basic_string<CharT>& putback_buffer()
+    /// Characters read before the current view, that are still available.
+    /// Owned by this buffer, or for `basic_scan_ref_buffer`, by the buffer
+    /// it refers to.
+    /// The view is only valid until the buffer is next filled,
+    /// or discards input.
+    SCN_NODISCARD std::basic_string_view<CharT> putback_buffer() const
+    {
+        return m_putback_view;
+    }
+
+    /// Position of the first character in the putback buffer.
+    /// Non-zero only if a prefix of it has been discarded,
+    /// see `set_bounded_putback()`.
+    SCN_NODISCARD std::ptrdiff_t putback_offset() const
+    {
+        return m_putback_offset;
+    }
+
+    /**
+     * Enable or disable bounded putback storage.
+     *
+     * By default, every character read from the source is kept in the
+     * putback buffer for the lifetime of the buffer.
+     * With bounded storage, characters before the position given to
+     * `release_until()` are discarded, once there's enough of them to make it
+     * worthwhile. The storage is reused, so memory usage stays proportional to
+     * the data still needed, and not to the size of the whole input.
+     *
+     * Disabled by default for every buffer type. In this mode, a scan from a
+     * range of this buffer releases its input after every scanned argument.
+     * Scans nested inside it (e.g. in a custom `scanner`) never release
+     * anything, so that the enclosing scan can still use its iterators.
+     *
+     * Ranges and iterators pointing before a released position can no longer
+     * be used, and a failed scan can only roll back (`sync()`) to the latest
+     * released position.
+     */
+    void set_bounded_putback(bool bounded)
+    {
+        m_bounded_putback = bounded;
+    }
+    SCN_NODISCARD bool has_bounded_putback() const
+    {
+        return m_bounded_putback;
+    }
+
+    /// Tell the buffer, that the characters before `position` won't be read
+    /// again. With bounded putback storage, they may be discarded.
+    virtual void release_until(std::ptrdiff_t position)
     {
-        return m_putback_buffer;
+        if (m_bounded_putback) {
+            discard_until(position);
+        }
     }
-    SCN_NODISCARD const std::basic_string<CharT>& putback_buffer() const
+
+    /// Discard the characters in the putback buffer before `position`,
+    /// regardless of `has_bounded_putback()`, once there's enough of them to
+    /// make it worthwhile. Ranges and iterators pointing before `position`
+    /// can no longer be used.
+    void discard_until(std::ptrdiff_t position)
     {
-        return m_putback_buffer;
+        const auto putback_size =
+            static_cast<std::ptrdiff_t>(m_putback_view.size());
+        auto n = position - m_putback_offset;
+        if (n > putback_size) {
+            n = putback_size;
+        }
+        // Only discard in larger chunks, and only when more is discarded than
+        // retained: moving the rest to the front is then amortized O(1)
+        if (n < putback_discard_threshold || n < putback_size - n) {
+            return;
+        }
+        m_putback_buffer.erase(0, static_cast<std::size_t>(n));
+        m_putback_view = m_putback_buffer;
+        m_putback_offset += n;
     }
 
     SCN_NODISCARD std::basic_string_view<CharT> get_segment_starting_at(
         std::ptrdiff_t pos) const
     {
+        pos -= m_putback_offset;
+        SCN_EXPECT(pos >= 0);
         if (SCN_UNLIKELY(
-                pos < static_cast<std::ptrdiff_t>(m_putback_buffer.size()))) {
-            return std::basic_string_view<CharT>(m_putback_buffer).substr(pos);
+                pos < static_cast<std::ptrdiff_t>(m_putback_view.size()))) {
+            return m_putback_view.substr(pos);
         }
-        const auto start = pos - m_putback_buffer.size();
+        const auto start = pos - m_putback_view.size();
         SCN_EXPECT(start <= m_current_view.size());
         return m_current_view.substr(start);
     }
 
     SCN_NODISCARD CharT get_character_at(std::ptrdiff_t pos) const
     {
+        pos -= m_putback_offset;
+        SCN_EXPECT(pos >= 0);
         if (SCN_UNLIKELY(
-                pos < static_cast<std::ptrdiff_t>(m_putback_buffer.size()))) {
-            return m_putback_buffer[pos];
+                pos < static_cast<std::ptrdiff_t>(m_putback_view.size()))) {
+            return m_putback_view[pos];
         }
-        const auto start = pos - m_putback_buffer.size();
+        const auto start = pos - m_putback_view.size();
         SCN_EXPECT(start < m_current_view.size());
         return m_current_view[start];
     }
@@ -4141,6 +4234,113 @@ public:
 
     SCN_NODISCARD range_type get();
 
+    /**
+     * Pin the buffer.
+     *
+     * While the buffer is pinned, `std::string_view`s can be scanned from it,
+     * even though it isn't contiguous.
+     * They point directly into the source, if it keeps its memory in place
+     * while pinned (like `scan_fd_buffer`, or `basic_scan_segmented_buffer`),
+     * or otherwise into a copy owned by the buffer.
+     * Either way, no allocation is done per value, and they stay valid
+     * until the buffer is unpinned.
+     *
+     * Pins nest: the buffer is unpinned when every call to `pin()` has been
+     * matched by a call to `unpin()`. See `basic_scan_buffer_pin` for a
+     * scoped pin.
+     */
+    virtual void pin()
+    {
+        ++m_pin_count;
+    }
+
+    /// Unpin the buffer. If it's no longer pinned, every `std::string_view`
+    /// scanned from it is invalidated.
+    virtual void unpin()
+    {
+        SCN_EXPECT(m_pin_count > 0);
+        if (--m_pin_count == 0) {
+            m_retired_blocks.clear();
+            // Keep the latest chunk around, to be reused by the next pin
+            if (!m_pinned_chunks.empty()) {
+                m_pinned_chunks.erase_after(m_pinned_chunks.begin(),
+                                            m_pinned_chunks.end());
+                m_pinned_chunks.front().clear();
+            }
+        }
+    }
+
+    SCN_NODISCARD virtual bool is_pinned() const
+    {
+        return m_pin_count != 0;
+    }
+
+    /// Returns a view of the characters in `[first, last)`,
+    /// valid until the buffer is unpinned.
+    SCN_NODISCARD virtual std::basic_string_view<CharT> get_pinned_view(
+        std::ptrdiff_t first,
+        std::ptrdiff_t last)
+    {
+        SCN_EXPECT(is_pinned());
+        SCN_EXPECT(first <= last);
+
+        const auto current_view_begin =
+            chars_available() -
+            static_cast<std::ptrdiff_t>(m_current_view.size());
+        if (m_stable_current_view && first >= current_view_begin) {
+            return m_current_view.substr(
+                static_cast<std::size_t>(first - current_view_begin),
+                static_cast<std::size_t>(last - first));
+        }
+
+        const auto n = static_cast<std::size_t>(last - first);
+        if (m_pinned_chunks.empty() ||
+            m_pinned_chunks.front().capacity() -
+                    m_pinned_chunks.front().size() <
+                n) {
+            // Appending to a chunk within its capacity never reallocates it,
+            // and the chunks themselves never move:
+            // previously returned views stay valid
+            m_pinned_chunks.push_front(make_internal_string());
+            m_pinned_chunks.front().reserve(n > pinned_chunk_size
+                                                ? n
+                                                : pinned_chunk_size);
+        }
+
+        auto& chunk = m_pinned_chunks.front();
+        const auto start = chunk.size();
+        for (auto pos = first; pos < last;) {
+            const auto segment = get_segment_starting_at(pos);
+            const auto k = detail::min(segment.size(),
+                                       static_cast<std::size_t>(last - pos));
+            chunk.append(segment.data(), k);
+            pos += static_cast<std::ptrdiff_t>(k);
+        }
+        return std::basic_string_view<CharT>{chunk.data() + start, n};
+    }
+
+#if SCN_HAS_MEMORY_RESOURCE
+    /**
+     * Allocate the internal storage of the buffer (putback buffer, and
+     * copies made while pinned) from `resource`, instead of the default
+     * memory resource.
+     *
+     * Has to be called before the buffer is first filled, or pinned.
+     * `resource` needs to outlive the buffer.
+     */
+    virtual void set_memory_resource(std::pmr::memory_resource* resource)
+    {
+        SCN_EXPECT(resource);
+        SCN_EXPECT(m_putback_view.empty() && m_pinned_chunks.empty());
+        reset_storage(m_putback_buffer, resource);
+    }
+
+    SCN_NODISCARD std::pmr::memory_resource* memory_resource() const
+    {
+        return m_putback_buffer.get_allocator().resource();
+    }
+#endif
+
 protected:
     friend class forward_iterator;
 
@@ -4163,9 +4363,70 @@ protected:
     {
     }
 
+    /// Move the contents of the current view to the end of the putback
+    /// buffer. The current view itself is left as-is.
+    /// Derived classes must use this in `fill()`: the putback storage
+    /// isn't accessible to them.
+    void append_current_view_to_putback()
+    {
+        if (!m_current_view.empty()) {
+            m_putback_buffer.append(m_current_view);
+            m_putback_view = m_putback_buffer;
+        }
+    }
+
+#if SCN_HAS_MEMORY_RESOURCE
+    // Replace `str`, which must be empty, with a string using `resource`:
+    // assigning a pmr string doesn't change its memory resource
+    static void reset_storage(internal_string<char_type>& str,
+                              std::pmr::memory_resource* resource)
+    {
+        SCN_EXPECT(str.empty());
+        std::destroy_at(&str);
+        ::new (static_cast<void*>(&str)) internal_string<char_type>(resource);
+    }
+#endif
+
+    SCN_NODISCARD internal_string<char_type> make_internal_string() const
+    {
+#if SCN_HAS_MEMORY_RESOURCE
+        return internal_string<char_type>(memory_resource());
+#else
+        return {};
+#endif
+    }
+
+    /// Keep `block` alive until the buffer is unpinned
+    void retire_pinned_block(internal_string<char_type>&& block)
+    {
+        SCN_EXPECT(is_pinned());
+        m_retired_blocks.push_front(SCN_MOVE(block));
+    }
+
+    static constexpr std::ptrdiff_t putback_discard_threshold = 4096;
+    static constexpr std::size_t pinned_chunk_size = 4096;
+
     std::basic_string_view<char_type> m_current_view{};
-    std::basic_string<char_type> m_putback_buffer{};
+    // Points to m_putback_buffer, unless it refers to another buffer
+    std::basic_string_view<char_type> m_putback_view{};
+    std::ptrdiff_t m_putback_offset{0};
     bool m_is_contiguous{false};
+    bool m_bounded_putback{false};
+    // If true, the memory pointed to by m_current_view isn't reused
+    // while the buffer is pinned
+    bool m_stable_current_view{false};
+
+private:
+    // Storage for m_putback_view: only modified through
+    // append_current_view_to_putback() and discard_until(), which keep the
+    // view in sync with it
+    internal_string<char_type> m_putback_buffer{};
+
+    // Copies made by get_pinned_view() while pinned, the latest first
+    std::forward_list<internal_string<char_type>> m_pinned_chunks{};
+    // Blocks given to retire_pinned_block(), freed when unpinned
+    std::forward_list<internal_string<char_type>> m_retired_blocks{};
+    std::size_t m_pin_count{0};
 };
 
 template <typename CharT>
@@ -4409,6 +4670,9 @@ public:
     using iterator = ranges::iterator_t<const Range>;
     using sentinel = ranges::sentinel_t<const Range>;
 
+    /// Maximum number of characters read from the source range per `fill()`
+    static constexpr std::size_t block_size = 64;
+
     template <
         typename R,
         std::enable_if_t<is_not_self<R, basic_scan_forward_buffer_impl> &&
@@ -4427,14 +4691,38 @@ public:
         if constexpr (mp_valid_v<less_than_compare, iterator, sentinel>) {
             SCN_EXPECT(m_cursor < ranges::end(*m_range));
         }
-        if (!this->m_current_view.empty()) {
-            this->m_putback_buffer.insert(this->m_putback_buffer.end(),
-                                          this->m_current_view.begin(),
-                                          this->m_current_view.end());
+        this->append_current_view_to_putback();
+
+        if constexpr (ranges::contiguous_iterator<iterator>) {
+            // Contiguous, but not sized:
+            // no need to copy, point directly to the source range
+            const auto first = to_address(m_cursor);
+            std::size_t n = 0;
+            for (; n < block_size && m_cursor != ranges::end(*m_range); ++n) {
+                ++m_cursor;
+            }
+            this->m_current_view = std::basic_string_view<char_type>{first, n};
+        }
+        else {
+            std::size_t n = 0;
+            if constexpr (ranges::sized_sentinel_for<sentinel, iterator>) {
+                n = detail::min(
+                    block_size,
+                    static_cast<std::size_t>(ranges::end(*m_range) - m_cursor));
+                for (std::size_t i = 0; i < n; ++i, ++m_cursor) {
+                    m_block[i] = *m_cursor;
+                }
+            }
+            else {
+                for (; n < block_size && m_cursor != ranges::end(*m_range);
+                     ++n, ++m_cursor) {
+                    m_block[n] = *m_cursor;
+                }
+            }
+            this->m_current_view =
+                std::basic_string_view<char_type>{m_block.data(), n};
         }
-        m_latest = *m_cursor;
-        ++m_cursor;
-        this->m_current_view = std::basic_string_view<char_type>{&m_latest, 1};
+
         if constexpr (mp_valid_v<less_than_compare, iterator, sentinel>) {
             SCN_EXPECT(m_cursor <= ranges::end(*m_range));
         }
@@ -4444,12 +4732,79 @@ public:
 private:
     const Range* m_range;
     iterator m_cursor;
-    char_type m_latest{};
+    std::array<char_type, block_size> m_block{};
 };
 
 template <typename R>
 basic_scan_forward_buffer_impl(const R&) -> basic_scan_forward_buffer_impl<R>;
 
+/**
+ * Scan buffer over a sequence of contiguous segments,
+ * like an iovec, or a rope of network buffers.
+ *
+ * Every `fill()` makes the next segment the current view, without copying it:
+ * readers process the input one segment at a time, and only values spanning
+ * segment boundaries are stitched together from the putback buffer.
+ *
+ * Scanning is done through the range returned by `get()`,
+ * continuing from the range returned in the result of the previous scan.
+ *
+ * Neither the array of segments, nor the segments themselves are owned by
+ * the buffer, and they must outlive it.
+ */
+template <typename CharT>
+class basic_scan_segmented_buffer : public basic_scan_buffer<CharT> {
+    using base = basic_scan_buffer<CharT>;
+
+public:
+    using segment_type = std::basic_string_view<CharT>;
+
+    basic_scan_segmented_buffer(const segment_type* segments, std::size_t count)
+        : base(typename base::non_contiguous_tag{}),
+          m_next(segments),
+          m_end(segments + count)
+    {
+        this->m_stable_current_view = true;
+    }
+
+    template <typename Segments,
+              std::enable_if_t<
+                  !std::is_same_v<remove_cvref_t<Segments>,
+                                  basic_scan_segmented_buffer> &&
+                  ranges::contiguous_range<const Segments&> &&
+                  ranges::sized_range<const Segments&> &&
+                  std::is_same_v<ranges::range_value_t<const Segments&>,
+                                 segment_type>>* = nullptr>
+    explicit basic_scan_segmented_buffer(const Segments& segments)
+        : basic_scan_segmented_buffer(ranges::data(segments),
+                                      ranges::size(segments))
+    {
+    }
+
+    bool fill() override
+    {
+        // Skip empty segments
+        while (m_next != m_end && m_next->empty()) {
+            ++m_next;
+        }
+        if (m_next == m_end) {
+            return false;
+        }
+
+        this->append_current_view_to_putback();
+        this->m_current_view = *m_next;
+        ++m_next;
+        return true;
+    }
+
+private:
+    const segment_type* m_next;
+    const segment_type* m_end;
+};
+
+using scan_segmented_buffer = basic_scan_segmented_buffer<char>;
+using wscan_segmented_buffer = basic_scan_segmented_buffer<wchar_t>;
+
 class scan_file_buffer : public basic_scan_buffer<char> {
     using base = basic_scan_buffer<char>;
 
@@ -4465,6 +4820,112 @@ private:
     std::optional<char_type> m_latest{std::nullopt};
 };
 
+#if SCN_POSIX
+/**
+ * Scan buffer reading directly from a POSIX file descriptor with `read(2)`,
+ * bypassing stdio and its locking.
+ *
+ * Reads are done in blocks, starting at `min_block_size`, and doubling up
+ * to `max_block_size` as long as the reads keep filling the whole block.
+ *
+ * Scanning is done through the range returned by `get()`,
+ * continuing from the range returned in the result of the previous scan.
+ * `sync()` records the position up to which the input was consumed;
+ * bytes read past it stay in the buffer, and are available for the next scan.
+ * When streaming large inputs, enable `set_bounded_putback()`, so that the
+ * input already scanned doesn't stay in memory.
+ *
+ * While the buffer is pinned, blocks aren't reused,
+ * and scanned `std::string_view`s point directly into them.
+ *
+ * The descriptor isn't owned, and is not closed by the buffer.
+ */
+class scan_fd_buffer : public basic_scan_buffer<char> {
+    using base = basic_scan_buffer<char>;
+
+public:
+    static constexpr std::size_t min_block_size = 64 * 1024;
+    static constexpr std::size_t max_block_size = 1024 * 1024;
+
+    explicit scan_fd_buffer(int fd);
+
+    bool fill() override;
+    void sync(std::ptrdiff_t position) override;
+
+#if SCN_HAS_MEMORY_RESOURCE
+    /// Also allocates the blocks read into from `resource`
+    void set_memory_resource(std::pmr::memory_resource* resource) override
+    {
+        base::set_memory_resource(resource);
+        reset_storage(m_block, resource);
+    }
+#endif
+
+    /// Position in the buffer, up to which input has been consumed,
+    /// as given by the latest call to `sync()`.
+    SCN_NODISCARD std::ptrdiff_t consumed() const
+    {
+        return m_consumed;
+    }
+
+private:
+    int m_fd;
+    std::size_t m_block_size{min_block_size};
+    internal_string<char> m_block{};
+    std::ptrdiff_t m_consumed{0};
+};
+#endif
+
+#if !SCN_DISABLE_THREADS
+/**
+ * Scan buffer reading a file with a background thread,
+ * so that the next block is read while the current one is being scanned.
+ *
+ * Two blocks of `block_size` bytes are used: while the scanner is processing
+ * one, the background thread is reading the next one with `std::fread`.
+ * The file must not be otherwise accessed while the buffer exists.
+ *
+ * Scanning is done through the range returned by `get()`,
+ * continuing from the range returned in the result of the previous scan.
+ * `sync()` records the position up to which the input was consumed.
+ * When the buffer is destroyed, if the file is seekable, it's repositioned to
+ * right after the consumed input. When streaming large inputs, enable
+ * `set_bounded_putback()`, so that the input already scanned doesn't stay in
+ * memory.
+ */
+class scan_readahead_file_buffer : public basic_scan_buffer<char> {
+    using base = basic_scan_buffer<char>;
+
+public:
+    static constexpr std::size_t default_block_size = 256 * 1024;
+
+    explicit scan_readahead_file_buffer(
+        std::FILE* file,
+        std::size_t block_size = default_block_size);
+    ~scan_readahead_file_buffer();
+
+    bool fill() override;
+    void sync(std::ptrdiff_t position) override;
+
+    /// Position in the buffer, up to which input has been consumed,
+    /// as given by the latest call to `sync()`.
+    SCN_NODISCARD std::ptrdiff_t consumed() const
+    {
+        return m_consumed;
+    }
+
+private:
+    struct reader;
+
+    std::FILE* m_file;
+    std::unique_ptr<reader> m_reader;
+    long m_start_offset;
+    std::ptrdiff_t m_consumed{0};
+    std::size_t m_block_index{0};
+    bool m_holds_block{false};
+};
+#endif
+
 template <typename CharT>
 class basic_scan_ref_buffer : public basic_scan_buffer<CharT> {
     using base = basic_scan_buffer<CharT>;
@@ -4475,9 +4936,17 @@ public:
           m_other(&other),
           m_starting_pos(starting_pos)
     {
+#if SCN_HAS_MEMORY_RESOURCE
+        // Used by temporaries created while scanning from this buffer
+        base::set_memory_resource(other.memory_resource());
+#endif
         this->m_current_view = other.get_segment_starting_at(starting_pos);
-        m_fill_needs_to_propagate = other.get_segment_starting_at(0).end() ==
-                                    this->m_current_view.end();
+        // If the segment is the current view of other (and not a part of
+        // its putback buffer), filling needs to go through other
+        m_fill_needs_to_propagate =
+            starting_pos >=
+            other.putback_offset() +
+                static_cast<std::ptrdiff_t>(other.putback_buffer().size());
     }
 
     basic_scan_ref_buffer(std::basic_string_view<CharT> view)
@@ -4493,20 +4962,100 @@ public:
         SCN_EXPECT(m_starting_pos >= 0);
 
         if (m_fill_needs_to_propagate) {
-            auto ret = m_other->fill();
-            this->m_current_view = m_other->current_view();
-            this->m_putback_buffer =
-                m_other->putback_buffer().substr(m_starting_pos);
-            return ret;
+            if (!m_other->fill()) {
+                return false;
+            }
         }
-
-        m_fill_needs_to_propagate = true;
-        this->m_putback_buffer = std::basic_string<CharT>{this->m_current_view};
-        this->m_current_view = m_other->current_view();
+        else {
+            // The current view is a part of the putback buffer of other,
+            // which is followed by the current view of other
+            m_fill_needs_to_propagate = true;
+        }
+        refer_to_other();
         return true;
     }
 
+    void sync(std::ptrdiff_t position) override
+    {
+        if (m_other) {
+            m_other->sync(m_starting_pos + position);
+        }
+    }
+
+    void pin() override
+    {
+        SCN_EXPECT(m_other);
+        m_other->pin();
+    }
+    void unpin() override
+    {
+        SCN_EXPECT(m_other);
+        m_other->unpin();
+    }
+
+    SCN_NODISCARD bool is_pinned() const override
+    {
+        return m_other && m_other->is_pinned();
+    }
+
+    SCN_NODISCARD std::basic_string_view<CharT> get_pinned_view(
+        std::ptrdiff_t first,
+        std::ptrdiff_t last) override
+    {
+        SCN_EXPECT(m_other);
+        return m_other->get_pinned_view(m_starting_pos + first,
+                                        m_starting_pos + last);
+    }
+
+    void release_until(std::ptrdiff_t position) override
+    {
+        // Only a scan directly over a buffer, which has bounded putback
+        // enabled by its owner, releases anything.
+        // A ref buffer never has it enabled itself, so a scan nested in
+        // another one (referring to the ref buffer of the enclosing scan)
+        // never releases input the enclosing scan may still use.
+        if (!m_other || !m_other->has_bounded_putback()) {
+            return;
+        }
+        m_other->release_until(m_starting_pos + position);
+
+        // Before the first fill, this buffer may start after the putback
+        // buffer of other, in its current view, which isn't affected
+        const auto other_putback_end =
+            m_other->putback_offset() +
+            static_cast<std::ptrdiff_t>(m_other->putback_buffer().size());
+        if (m_starting_pos <= other_putback_end) {
+            refer_to_other();
+        }
+    }
+
 private:
+    // Point the putback buffer and the current view of this buffer
+    // to the corresponding parts of other, instead of copying them.
+    // Needs to be done whenever other may have modified its putback buffer.
+    void refer_to_other()
+    {
+        // Skip whatever has been released, either here or in other
+        auto offset = m_other->putback_offset() - m_starting_pos;
+        if (offset < this->m_putback_offset) {
+            offset = this->m_putback_offset;
+        }
+        const auto other_putback = m_other->putback_buffer().substr(
+            static_cast<std::size_t>(offset + m_starting_pos -
+                                     m_other->putback_offset()));
+        this->m_putback_offset = offset;
+        if (m_fill_needs_to_propagate) {
+            this->m_putback_view = other_putback;
+            this->m_current_view = m_other->current_view();
+        }
+        else {
+            // Until the first fill, the current view of this buffer is
+            // the rest of the putback buffer of other
+            this->m_putback_view = {};
+            this->m_current_view = other_putback;
+        }
+    }
+
     base* m_other;
     std::ptrdiff_t m_starting_pos{-1};
     bool m_fill_needs_to_propagate{false};
@@ -4520,6 +5069,61 @@ template <typename CharT>
 basic_scan_ref_buffer(std::basic_string_view<CharT>)
     -> basic_scan_ref_buffer<CharT>;
 
+/**
+ * Pins a scan buffer for the lifetime of this object.
+ *
+ * \see basic_scan_buffer::pin()
+ */
+template <typename CharT>
+class basic_scan_buffer_pin {
+public:
+    explicit basic_scan_buffer_pin(basic_scan_buffer<CharT>& buffer)
+        : m_buffer(&buffer)
+    {
+        m_buffer->pin();
+    }
+
+    basic_scan_buffer_pin(const basic_scan_buffer_pin&) = delete;
+    basic_scan_buffer_pin& operator=(const basic_scan_buffer_pin&) = delete;
+
+    basic_scan_buffer_pin(basic_scan_buffer_pin&& other) noexcept
+        : m_buffer(other.m_buffer)
+    {
+        other.m_buffer = nullptr;
+    }
+    basic_scan_buffer_pin& operator=(basic_scan_buffer_pin&& other) noexcept
+    {
+        reset();
+        m_buffer = other.m_buffer;
+        other.m_buffer = nullptr;
+        return *this;
+    }
+
+    ~basic_scan_buffer_pin()
+    {
+        reset();
+    }
+
+    /// Unpin the buffer before the end of the lifetime of this object
+    void reset()
+    {
+        if (m_buffer) {
+            m_buffer->unpin();
+            m_buffer = nullptr;
+        }
+    }
+
+private:
+    basic_scan_buffer<CharT>* m_buffer;
+};
+
+template <typename CharT>
+basic_scan_buffer_pin(basic_scan_buffer<CharT>&)
+    -> basic_scan_buffer_pin<CharT>;
+
+using scan_buffer_pin = basic_scan_buffer_pin<char>;
+using wscan_buffer_pin = basic_scan_buffer_pin<wchar_t>;
+
 template <typename Range>
 auto make_string_scan_buffer(const Range& range)
 {
@@ -4783,29 +5387,138 @@ auto make_scan_buffer(Range&&) = delete;
 }  // namespace detail
 
 /////////////////////////////////////////////////////////////////
-// Argument type erasure
+// Memory-mapped files
 /////////////////////////////////////////////////////////////////
 
-namespace detail {
-enum class arg_type : unsigned char {
-    none_type,
-    schar_type,
-    short_type,
-    int_type,
-    long_type,
-    llong_type,
-    uchar_type,
-    ushort_type,
-    uint_type,
-    ulong_type,
-    ullong_type,
-    bool_type,
-    narrow_character_type,
-    wide_character_type,
-    code_point_type,
-    pointer_type,
-    float_type,
-    double_type,
+/**
+ * A read-only view of the entire contents of a file.
+ *
+ * On POSIX systems, regular files are memory-mapped, and the kernel is
+ * advised that the mapping will be read sequentially.
+ * Other files (pipes, character devices, files in procfs),
+ * and all files on other platforms, are read into memory in full.
+ *
+ * `mapped_file` is a contiguous and sized range of `char`,
+ * so scanning from it takes the same fast path as scanning from a
+ * `std::string_view`: no data is copied per chunk,
+ * and scanned `std::string_view`s point directly into the file contents.
+ * They're valid for as long as the `mapped_file` is alive.
+ *
+ * Unlike when scanning from a `FILE*`, nothing is synchronized with the
+ * underlying file: the position to continue from is given by the range
+ * returned in the result, like with any other range.
+ *
+ * \code{.cpp}
+ * auto file = scn::mapped_file{"data.txt"};
+ * if (!file.valid()) {
+ *     // couldn't open or read the file
+ * }
+ * auto input = scn::ranges::subrange{file.begin(), file.end()};
+ * while (auto result = scn::scan<std::string_view, int>(input, "{} {}")) {
+ *     input = result->range();
+ * }
+ * \endcode
+ *
+ * \ingroup scannable
+ */
+class mapped_file {
+public:
+    using value_type = char;
+    using iterator = const char*;
+
+    /// Constructs an invalid, empty `mapped_file`.
+    mapped_file() = default;
+
+    /// Opens and maps (or reads) the file at `path`.
+    /// If that fails, `valid()` will return `false`.
+    explicit mapped_file(const char* path);
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept;
+    mapped_file& operator=(mapped_file&& other) noexcept;
+
+    ~mapped_file();
+
+    /// `true`, if the file was successfully opened and mapped or read.
+    bool valid() const
+    {
+        return m_valid;
+    }
+    explicit operator bool() const
+    {
+        return valid();
+    }
+
+    /// `true`, if the file contents are memory-mapped,
+    /// `false`, if they were read into memory.
+    bool is_mapped() const
+    {
+        return m_is_mapped;
+    }
+
+    const char* data() const
+    {
+        return m_data;
+    }
+    std::size_t size() const
+    {
+        return m_size;
+    }
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    iterator begin() const
+    {
+        return m_data;
+    }
+    iterator end() const
+    {
+        return m_data + m_size;
+    }
+
+    std::string_view view() const
+    {
+        return {m_data, m_size};
+    }
+
+private:
+    void release();
+
+    const char* m_data{nullptr};
+    std::size_t m_size{0};
+    std::string m_buffer{};
+    bool m_is_mapped{false};
+    bool m_valid{false};
+};
+
+/////////////////////////////////////////////////////////////////
+// Argument type erasure
+/////////////////////////////////////////////////////////////////
+
+namespace detail {
+enum class arg_type : unsigned char {
+    none_type,
+    schar_type,
+    short_type,
+    int_type,
+    long_type,
+    llong_type,
+    uchar_type,
+    ushort_type,
+    uint_type,
+    ulong_type,
+    ullong_type,
+    bool_type,
+    narrow_character_type,
+    wide_character_type,
+    code_point_type,
+    pointer_type,
+    float_type,
+    double_type,
     ldouble_type,
     narrow_string_view_type,
     wide_string_view_type,
@@ -5974,7 +6687,10 @@ public:
                           ranges::contiguous_range<Source>),
           m_is_borrowed(
               (ranges::range<Source> && ranges::borrowed_range<Source>) ||
-              std::is_same_v<detail::remove_cvref_t<Source>, std::FILE*>)
+              std::is_same_v<detail::remove_cvref_t<Source>, std::FILE*>),
+          m_is_buffer_range(
+              std::is_same_v<detail::remove_cvref_t<Source>,
+                             typename basic_scan_buffer<CharT>::range_type>)
     {
     }
 
@@ -6012,9 +6728,10 @@ public:
     {
         auto type = get_arg_type(id);
 
+        // Buffers can be pinned, which is checked at run time
         if ((type == arg_type::narrow_string_view_type ||
              type == arg_type::wide_string_view_type) &&
-            !m_is_contiguous) {
+            !m_is_contiguous && !m_is_buffer_range) {
             // clang-format off
             this->on_error("Cannot read a string_view from a non-contiguous source");
             // clang-format on
@@ -6042,7 +6759,7 @@ public:
 private:
     int m_num_args;
     const arg_type* m_types;
-    bool m_is_contiguous, m_is_borrowed;
+    bool m_is_contiguous, m_is_borrowed, m_is_buffer_range;
 
     SCN_GCC_POP  // -Wsign-conversion
 };
@@ -7707,12 +8424,62 @@ inline detail::basic_runtime_format_string<wchar_t> runtime_format(
     return s;
 }
 
+/**
+ * Statistics of the format string cache, see `set_format_cache_capacity`.
+ *
+ * \ingroup format-string
+ */
+struct format_cache_stats {
+    /// Number of scans that used a cached format string
+    std::size_t hits{0};
+    /// Number of scans that didn't find their format string in the cache
+    std::size_t misses{0};
+    /// Number of format strings currently in the cache
+    std::size_t size{0};
+    /// Maximum number of cached format strings, per character type
+    std::size_t capacity{0};
+};
+
+/**
+ * Enable caching parsed format strings, so that scanning with the same
+ * format string again doesn't need to parse it.
+ * At most `capacity` format strings are kept per character type, evicting
+ * the ones not used recently first. A `capacity` of `0` disables the cache,
+ * which is the default.
+ *
+ * Format strings are looked up by their address and length,
+ * so the cache is useful for format strings that are kept alive and
+ * scanned with repeatedly, like runtime format strings loaded from
+ * configuration. The contents of a cached format string, and the types of the
+ * arguments, are compared before using it, so a format string being replaced
+ * by a different one at the same address is handled correctly.
+ * Format strings with arguments of custom types aren't cached.
+ *
+ * Clears the cache, and resets its statistics.
+ * The cache is thread-safe, unless `SCN_DISABLE_THREADS` is set.
+ *
+ * \ingroup format-string
+ */
+void set_format_cache_capacity(std::size_t capacity);
+
+/**
+ * Get the hit and miss counts, and the current size of the format string
+ * cache.
+ *
+ * \ingroup format-string
+ */
+format_cache_stats get_format_cache_stats();
+
 namespace detail {
 struct compile_string {};
+struct compiled_string : compile_string {};
 
 template <typename Str>
 inline constexpr bool is_compile_string_v =
     std::is_base_of_v<compile_string, Str>;
+template <typename Str>
+inline constexpr bool is_compiled_string_v =
+    std::is_base_of_v<compiled_string, Str>;
 
 template <typename Scanner, typename = void>
 inline constexpr bool scanner_has_format_specs_member_v = false;
@@ -7935,6 +8702,20 @@ constexpr std::basic_string_view<CharT> compile_string_to_view(
 
 #define SCN_STRING(s) SCN_STRING_IMPL(s, ::scn::detail::compile_string, )
 
+/**
+ * Compile-time format string, which is turned into statically dispatched
+ * code when passed to `scan`: the format string is parsed at compile time,
+ * and every replacement field is read directly with the reader for its type.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<int, int>("1 ff", SCN_COMPILE("{} {:x}"));
+ * \endcode
+ *
+ * \ingroup format-string
+ */
+#define SCN_COMPILE(s) \
+    SCN_STRING_IMPL(s, ::scn::detail::compiled_string, explicit)
+
 /**
  * Compile-time format string
  *
@@ -8370,6 +9151,44 @@ struct scanner<discard<T>, CharT> : public scanner<T, CharT> {
     }
 };
 
+#if SCN_HAS_MEMORY_RESOURCE
+/**
+ * `scanner` for `std::pmr::basic_string`.
+ * Supports the same format specifiers as `std::basic_string`.
+ *
+ * The value is read through a `std::basic_string_view`, and then copied into
+ * memory allocated by the allocator of the string.
+ * A non-contiguous source is pinned while reading from it,
+ * see `basic_scan_buffer::pin()`.
+ * For contiguous sources, that's the only copy made. So it is for buffers
+ * that keep their memory in place while pinned (like `scan_fd_buffer`),
+ * unless the value spans multiple reads from the source.
+ * Otherwise, like for `FILE*`s and forward ranges, the characters are first
+ * copied into the pinned storage of the buffer, and so copied twice.
+ */
+template <typename CharT>
+struct scanner<std::pmr::basic_string<CharT>, CharT>
+    : public scanner<std::basic_string_view<CharT>, CharT> {
+    template <typename Context>
+    auto scan(std::pmr::basic_string<CharT>& val, Context& ctx) const
+        -> scan_expected<typename Context::iterator>
+    {
+        std::optional<detail::basic_scan_buffer_pin<CharT>> pin{};
+        if (auto it = ctx.begin(); it.stores_parent()) {
+            pin.emplace(*it.parent());
+        }
+
+        std::basic_string_view<CharT> view{};
+        auto result =
+            scanner<std::basic_string_view<CharT>, CharT>::scan(view, ctx);
+        if (SCN_LIKELY(result)) {
+            val.assign(view.data(), view.size());
+        }
+        return result;
+    }
+};
+#endif
+
 namespace detail {
 template <typename Range>
 scan_expected<ranges::iterator_t<Range>> internal_skip_classic_whitespace(
@@ -8511,6 +9330,287 @@ constexpr decltype(auto) visit_scan_arg(Visitor&& vis, basic_scan_arg<Ctx>& arg)
     SCN_UNREACHABLE;
 }
 
+/////////////////////////////////////////////////////////////////
+// Compiled format strings
+/////////////////////////////////////////////////////////////////
+
+namespace detail {
+/**
+ * A single replacement field of a compiled format string,
+ * alongside the literal text preceding it.
+ *
+ * The literal text is stored as a slice of the original format string,
+ * which means that it may contain escaped (doubled) braces.
+ */
+template <typename CharT>
+struct compiled_format_field {
+    const CharT* literal_begin{nullptr};
+    const CharT* literal_end{nullptr};
+    /// Beginning of the format specs (after ':'), or `nullptr` if none
+    const CharT* specs_begin{nullptr};
+    /// Whether `specs` were parsed from the format string.
+    /// Tested instead of `specs_begin`, which can't be compared to `nullptr`
+    /// in a constant expression without warnings.
+    bool has_specs{false};
+    std::size_t arg_id{0};
+    format_specs specs{};
+};
+
+/**
+ * Type-erased view of a `basic_compiled_format`, passed to `vscan_compiled`.
+ */
+template <typename CharT>
+struct basic_compiled_format_view {
+    std::basic_string_view<CharT> format;
+    const compiled_format_field<CharT>* fields;
+    std::size_t field_count;
+    const CharT* trailing_literal_begin;
+    const CharT* trailing_literal_end;
+};
+
+template <typename T, typename CharT>
+constexpr scan_expected<const CharT*> parse_compiled_format_specs(
+    basic_scan_parse_context<CharT>& pctx,
+    format_specs& specs)
+{
+    if constexpr (arg_type_constant<T, CharT>::value ==
+                  arg_type::custom_type) {
+        // Custom scanners can't store their parsed state in `format_specs`:
+        // only validate the specs here, they're parsed again when scanning.
+        SCN_UNUSED(specs);
+        auto s = scanner<T, CharT>{};
+        return s.parse(pctx);
+    }
+    else {
+        return scanner_parse_for_builtin_type<T>(pctx, specs);
+    }
+}
+
+template <typename CharT, typename... Args>
+class compiled_format_builder {
+public:
+    static constexpr auto num_args = sizeof...(Args);
+    using field_type = compiled_format_field<CharT>;
+
+    constexpr compiled_format_builder(std::basic_string_view<CharT> format,
+                                      field_type* fields)
+        : m_parse_ctx(format),
+          m_fields(fields),
+          m_parse_funcs{&parse_compiled_format_specs<Args, CharT>...}
+    {
+    }
+
+    constexpr void on_literal_text(const CharT* begin, const CharT* end)
+    {
+        // Escaped braces cause on_literal_text to be called
+        // multiple times for a single stretch of literal text:
+        // keep track of the whole stretch
+        if (!m_literal_begin) {
+            m_literal_begin = begin;
+        }
+        m_literal_end = end;
+    }
+
+    constexpr std::size_t on_arg_id()
+    {
+        return m_parse_ctx.next_arg_id();
+    }
+    constexpr std::size_t on_arg_id(std::size_t id)
+    {
+        m_parse_ctx.check_arg_id(id);
+        return id;
+    }
+
+    constexpr void on_replacement_field(std::size_t id, const CharT*)
+    {
+        add_field(id);
+    }
+
+    constexpr const CharT* on_format_specs(std::size_t id,
+                                           const CharT* begin,
+                                           const CharT* end)
+    {
+        auto* field = add_field(id);
+        if (SCN_UNLIKELY(!field)) {
+            return begin;
+        }
+
+        auto pctx = basic_scan_parse_context<CharT>{
+            make_string_view_from_pointers(begin, end)};
+        auto r = m_parse_funcs[id](pctx, field->specs);
+        if (SCN_UNLIKELY(!r)) {
+            on_error(r.error());
+            return begin;
+        }
+
+        field->specs_begin = begin;
+        field->has_specs = true;
+        return *r;
+    }
+
+    constexpr void check_args_exhausted()
+    {
+        if (m_field_count != num_args) {
+            on_error("Argument list not exhausted");
+        }
+    }
+
+    constexpr void on_error(const char* msg)
+    {
+        SCN_UNLIKELY_ATTR
+        m_error = scan_error{scan_error::invalid_format_string, msg};
+    }
+    constexpr void on_error(scan_error err)
+    {
+        if (SCN_UNLIKELY(err != scan_error::good)) {
+            m_error = err;
+        }
+    }
+
+    explicit constexpr operator bool() const
+    {
+        return static_cast<bool>(m_error);
+    }
+    SCN_NODISCARD constexpr scan_error get_error() const
+    {
+        return m_error;
+    }
+
+    constexpr const CharT* literal_begin() const
+    {
+        return m_literal_begin;
+    }
+    constexpr const CharT* literal_end() const
+    {
+        return m_literal_end;
+    }
+
+private:
+    constexpr field_type* add_field(std::size_t id)
+    {
+        if (SCN_UNLIKELY(id >= num_args)) {
+            on_error("Invalid out-of-range argument ID");
+            return nullptr;
+        }
+        if (SCN_UNLIKELY(m_visited_args[id])) {
+            on_error("Argument with this ID has already been scanned");
+            return nullptr;
+        }
+        m_visited_args[id] = true;
+
+        auto& field = m_fields[m_field_count++];
+        field.literal_begin = m_literal_begin;
+        field.literal_end = m_literal_end;
+        field.arg_id = id;
+        m_literal_begin = nullptr;
+        m_literal_end = nullptr;
+        return &field;
+    }
+
+    using parse_func = scan_expected<const CharT*> (*)(
+        basic_scan_parse_context<CharT>&,
+        format_specs&);
+
+    basic_scan_parse_context<CharT> m_parse_ctx;
+    field_type* m_fields;
+    parse_func m_parse_funcs[num_args > 0 ? num_args : 1];
+    bool m_visited_args[num_args > 0 ? num_args : 1] = {false};
+    std::size_t m_field_count{0};
+    const CharT* m_literal_begin{nullptr};
+    const CharT* m_literal_end{nullptr};
+    scan_error m_error{};
+};
+}  // namespace detail
+
+/**
+ * A format string, that has been parsed into a reusable plan:
+ * the literal text between the replacement fields, and the
+ * format specifiers of every argument.
+ *
+ * Scanning with a `basic_compiled_format` skips parsing the format string,
+ * which makes it useful when the same format string is used repeatedly,
+ * e.g. in a loop.
+ *
+ * Created with `compile_format`.
+ * The format string is not copied:
+ * it must outlive the `basic_compiled_format` object.
+ *
+ * \code{.cpp}
+ * auto fmt = scn::compile_format<int, int>("{} {:x}").value();
+ * for (auto line : lines) {
+ *     auto result = scn::scan(line, fmt);
+ *     // ...
+ * }
+ * \endcode
+ *
+ * \ingroup format-string
+ */
+template <typename CharT, typename... Args>
+class basic_compiled_format {
+public:
+    using char_type = CharT;
+
+    /**
+     * Parse `format` into a `basic_compiled_format`.
+     * Returns an error if `format` is invalid.
+     */
+    static scan_expected<basic_compiled_format> compile(
+        std::basic_string_view<CharT> format)
+    {
+        basic_compiled_format result{};
+        result.m_format = format;
+
+        auto builder = detail::compiled_format_builder<CharT, Args...>{
+            format, result.m_fields.data()};
+        if (auto e = detail::parse_format_string<false>(format, builder);
+            SCN_UNLIKELY(!e)) {
+            return unexpected(e);
+        }
+
+        result.m_trailing_literal_begin = builder.literal_begin();
+        result.m_trailing_literal_end = builder.literal_end();
+        return result;
+    }
+
+    /// The original format string
+    constexpr std::basic_string_view<CharT> get() const
+    {
+        return m_format;
+    }
+
+    constexpr detail::basic_compiled_format_view<CharT> view() const
+    {
+        return {m_format, m_fields.data(), m_fields.size(),
+                m_trailing_literal_begin, m_trailing_literal_end};
+    }
+
+private:
+    constexpr basic_compiled_format() = default;
+
+    std::basic_string_view<CharT> m_format{};
+    std::array<detail::compiled_format_field<CharT>, sizeof...(Args)>
+        m_fields{};
+    const CharT* m_trailing_literal_begin{nullptr};
+    const CharT* m_trailing_literal_end{nullptr};
+};
+
+/**
+ * Parse `format` into a `compiled_format`, to be used with `scan`.
+ *
+ * If `format` is a compile-time format string, it's checked at compile
+ * time, like with `scan`. Use `runtime_format` for format strings
+ * only known at runtime, in which case errors are reported through the
+ * return value.
+ *
+ * \ingroup format-string
+ */
+template <typename... Args>
+auto compile_format(scan_format_string<std::string_view, Args...> format)
+    -> scan_expected<compiled_format<Args...>>
+{
+    return compiled_format<Args...>::compile(format.get());
+}
+
 /////////////////////////////////////////////////////////////////
 // vscan
 /////////////////////////////////////////////////////////////////
@@ -8593,6 +9693,51 @@ scan_expected<std::ptrdiff_t> vscan_value_impl(
     wscan_buffer& source,
     basic_scan_arg<wscan_context> arg);
 
+struct scan_all_impl_result {
+    std::ptrdiff_t position;
+    std::size_t count;
+    scan_error error;
+};
+
+using scan_all_callback = void (*)(void*);
+
+scan_all_impl_result vscan_all_impl(std::string_view source,
+                                    std::string_view format,
+                                    scan_args args,
+                                    scan_all_callback on_value,
+                                    void* on_value_data);
+
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    std::string_view source,
+    basic_compiled_format_view<char> format,
+    scan_args args);
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    scan_buffer& source,
+    basic_compiled_format_view<char> format,
+    scan_args args);
+
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    std::wstring_view source,
+    basic_compiled_format_view<wchar_t> format,
+    wscan_args args);
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    wscan_buffer& source,
+    basic_compiled_format_view<wchar_t> format,
+    wscan_args args);
+
+scan_expected<std::ptrdiff_t> match_compiled_literal_impl(
+    std::string_view source,
+    std::string_view literal);
+scan_expected<std::ptrdiff_t> match_compiled_literal_impl(
+    std::wstring_view source,
+    std::wstring_view literal);
+
+template <typename T, typename CharT>
+scan_expected<std::ptrdiff_t> scan_compiled_value_impl(
+    std::basic_string_view<CharT> source,
+    T& value,
+    const format_specs* specs);
+
 template <typename Range, typename CharT>
 auto vscan_generic(Range&& range,
                    std::basic_string_view<CharT> format,
@@ -8647,6 +9792,189 @@ auto vscan_value_generic(Range&& range,
     }
     return detail::make_vscan_result_range(SCN_FWD(range), *result);
 }
+
+template <typename Range, typename CharT>
+auto vscan_compiled_generic(Range&& range,
+                            basic_compiled_format_view<CharT> format,
+                            basic_scan_args<basic_scan_context<CharT>> args)
+    -> vscan_result<Range>
+{
+    auto buffer = detail::make_scan_buffer(range);
+
+    auto result = detail::vscan_compiled_impl(buffer, format, args);
+    if (SCN_UNLIKELY(!result)) {
+        return unexpected(result.error());
+    }
+    return detail::make_vscan_result_range(SCN_FWD(range), *result);
+}
+
+template <typename CharT, std::size_t N>
+struct static_compiled_format_plan {
+    std::array<compiled_format_field<CharT>, N> fields{};
+    const CharT* trailing_literal_begin{nullptr};
+    const CharT* trailing_literal_end{nullptr};
+};
+
+template <typename CharT, typename... Args>
+constexpr auto make_static_compiled_format_plan(
+    std::basic_string_view<CharT> format)
+{
+    static_compiled_format_plan<CharT, sizeof...(Args)> plan{};
+    auto builder =
+        compiled_format_builder<CharT, Args...>{format, plan.fields.data()};
+    // Errors have already been reported by check_format_string
+    const auto e = parse_format_string<true>(format, builder);
+    SCN_UNUSED(e);
+
+    plan.trailing_literal_begin = builder.literal_begin();
+    plan.trailing_literal_end = builder.literal_end();
+    return plan;
+}
+
+// Literal text without whitespace, escaped braces, or non-ASCII characters
+// can be matched code unit by code unit
+template <typename CharT>
+constexpr bool is_plain_compiled_literal(const CharT* begin, const CharT* end)
+{
+    for (; begin != end; ++begin) {
+        const auto ch = static_cast<char32_t>(*begin);
+        if (ch >= 0x80 || ch == '{' || ch == '}' || ch == ' ' ||
+            (ch >= 0x09 && ch <= 0x0d)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Types mapped to themselves by arg_mapper are scanned with a builtin reader
+template <typename T, typename CharT>
+inline constexpr bool is_statically_scannable_v =
+    std::is_same_v<decltype(arg_mapper<CharT>::map(SCN_DECLVAL(T&))), T&>;
+
+/**
+ * Format string created with `SCN_COMPILE`, parsed at compile time.
+ *
+ * When scanning from a contiguous source, every field is read with
+ * `scan_compiled_value_impl` for its type, and plain literal text is matched
+ * inline.
+ */
+template <typename Str, typename... Args>
+struct static_compiled_format {
+    using char_type = typename Str::char_type;
+    using values_type = std::tuple<Args...>;
+
+    static constexpr auto format = std::basic_string_view<char_type>{Str{}};
+    static constexpr auto plan =
+        make_static_compiled_format_plan<char_type, Args...>(format);
+
+    static constexpr bool is_static =
+        (is_statically_scannable_v<Args, char_type> && ...);
+
+    static constexpr basic_compiled_format_view<char_type> view()
+    {
+        return {format, plan.fields.data(), plan.fields.size(),
+                plan.trailing_literal_begin, plan.trailing_literal_end};
+    }
+
+    static scan_expected<std::ptrdiff_t> scan(
+        std::basic_string_view<char_type> source,
+        values_type& values)
+    {
+        return scan_fields(source, values, std::index_sequence_for<Args...>{});
+    }
+
+private:
+    template <std::size_t... Is>
+    static scan_expected<std::ptrdiff_t> scan_fields(
+        std::basic_string_view<char_type> source,
+        values_type& values,
+        std::index_sequence<Is...>)
+    {
+        std::ptrdiff_t n = 0;
+        scan_error err{};
+        if (SCN_UNLIKELY(!(scan_field<Is>(source, n, values, err) && ...))) {
+            return unexpected(err);
+        }
+
+        constexpr bool plain = is_plain_compiled_literal(
+            plan.trailing_literal_begin, plan.trailing_literal_end);
+        if (SCN_UNLIKELY(!match_literal<plain>(source, n,
+                                               plan.trailing_literal_begin,
+                                               plan.trailing_literal_end,
+                                               err))) {
+            return unexpected(err);
+        }
+        return n;
+    }
+
+    template <std::size_t I>
+    static bool scan_field(std::basic_string_view<char_type> source,
+                           std::ptrdiff_t& n,
+                           values_type& values,
+                           scan_error& err)
+    {
+        constexpr const auto& field = plan.fields[I];
+        constexpr bool plain =
+            is_plain_compiled_literal(field.literal_begin, field.literal_end);
+        if (SCN_UNLIKELY(!match_literal<plain>(source, n, field.literal_begin,
+                                               field.literal_end, err))) {
+            return false;
+        }
+
+        constexpr auto id = field.arg_id;
+        using value_type = std::tuple_element_t<id, values_type>;
+        const format_specs* specs = nullptr;
+        if constexpr (field.has_specs) {
+            specs = &field.specs;
+        }
+        auto r = scan_compiled_value_impl<value_type, char_type>(
+            source.substr(static_cast<std::size_t>(n)), std::get<id>(values),
+            specs);
+        if (SCN_UNLIKELY(!r)) {
+            err = r.error();
+            return false;
+        }
+        n += *r;
+        return true;
+    }
+
+    template <bool Plain>
+    static bool match_literal(std::basic_string_view<char_type> source,
+                              std::ptrdiff_t& n,
+                              const char_type* begin,
+                              const char_type* end,
+                              scan_error& err)
+    {
+        if constexpr (Plain) {
+            for (; begin != end; ++begin, ++n) {
+                if (SCN_UNLIKELY(static_cast<std::size_t>(n) ==
+                                 source.size())) {
+                    err = scan_error{scan_error::invalid_format_string,
+                                     "Unexpected end of source"};
+                    return false;
+                }
+                if (SCN_UNLIKELY(source[static_cast<std::size_t>(n)] !=
+                                 *begin)) {
+                    err = scan_error{scan_error::invalid_format_string,
+                                     "Unexpected literal character in source"};
+                    return false;
+                }
+            }
+            return true;
+        }
+        else {
+            auto r = match_compiled_literal_impl(
+                source.substr(static_cast<std::size_t>(n)),
+                make_string_view_from_pointers(begin, end));
+            if (SCN_UNLIKELY(!r)) {
+                err = r.error();
+                return false;
+            }
+            n += *r;
+            return true;
+        }
+    }
+};
 }  // namespace detail
 
 SCN_GCC_PUSH
@@ -8696,6 +10024,22 @@ auto vscan_value(Source&& source, basic_scan_arg<scan_context> arg)
     return detail::vscan_value_generic(SCN_FWD(source), arg);
 }
 
+/**
+ * Perform actual scanning from `source`, according to the pre-parsed
+ * `format`, into the type-erased arguments at `args`.
+ * Called by `scan`, when given a `compiled_format`.
+ *
+ * \ingroup vscan
+ */
+template <typename Source, typename... Args>
+auto vscan_compiled(Source&& source,
+                    const compiled_format<Args...>& format,
+                    scan_args args) -> vscan_result<Source>
+{
+    return detail::vscan_compiled_generic(SCN_FWD(source), format.view(),
+                                          args);
+}
+
 /**
  * Perform actual scanning from `stdin`, according to `format`, into the
  * type-erased arguments at `args`. Called by `input`.
@@ -8712,6 +10056,21 @@ auto scan_int_impl(std::string_view source, T& value, int base)
 template <typename T>
 auto scan_int_exhaustive_valid_impl(std::string_view source) -> T;
 
+struct scan_int_array_impl_result {
+    std::ptrdiff_t position;
+    std::size_t count;
+    scan_error error;
+    // `capacity` values were written, and `position` is at the beginning
+    // of the next one
+    bool full;
+};
+
+template <typename T>
+auto scan_int_array_impl(std::string_view source,
+                         char delimiter,
+                         T* out,
+                         std::size_t capacity) -> scan_int_array_impl_result;
+
 #if !SCN_DISABLE_TYPE_SCHAR
 extern template auto scan_int_impl(std::string_view source,
                                    signed char& value,
@@ -8719,6 +10078,11 @@ extern template auto scan_int_impl(std::string_view source,
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> signed char;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         signed char*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_SHORT
 extern template auto scan_int_impl(std::string_view source,
@@ -8726,6 +10090,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view) -> short;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         short*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_INT
 extern template auto scan_int_impl(std::string_view source,
@@ -8733,6 +10102,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view) -> int;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         int*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_LONG
 extern template auto scan_int_impl(std::string_view source,
@@ -8740,6 +10114,11 @@ extern template auto scan_int_impl(std::string_view source,
                                    int base)
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view) -> long;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         long*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_LONG_LONG
 extern template auto scan_int_impl(std::string_view source,
@@ -8748,6 +10127,11 @@ extern template auto scan_int_impl(std::string_view source,
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> long long;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         long long*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_UCHAR
 extern template auto scan_int_impl(std::string_view source,
@@ -8756,6 +10140,11 @@ extern template auto scan_int_impl(std::string_view source,
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned char;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         unsigned char*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_USHORT
 extern template auto scan_int_impl(std::string_view source,
@@ -8764,6 +10153,11 @@ extern template auto scan_int_impl(std::string_view source,
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned short;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         unsigned short*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_UINT
 extern template auto scan_int_impl(std::string_view source,
@@ -8772,6 +10166,11 @@ extern template auto scan_int_impl(std::string_view source,
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned int;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         unsigned int*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG
 extern template auto scan_int_impl(std::string_view source,
@@ -8780,6 +10179,11 @@ extern template auto scan_int_impl(std::string_view source,
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned long;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         unsigned long*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG_LONG
 extern template auto scan_int_impl(std::string_view source,
@@ -8788,6 +10192,11 @@ extern template auto scan_int_impl(std::string_view source,
     -> scan_expected<std::string_view::iterator>;
 extern template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned long long;
+extern template auto scan_int_array_impl(std::string_view,
+                                         char,
+                                         unsigned long long*,
+                                         std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 
 }  // namespace detail
@@ -8911,6 +10320,77 @@ SCN_NODISCARD auto scan(Source&& source,
     return make_scan_result(SCN_MOVE(result), SCN_MOVE(args.args()));
 }
 
+/**
+ * `scan` using a pre-parsed format string.
+ *
+ * \code{.cpp}
+ * auto fmt = scn::compile_format<int>("{}").value();
+ * if (auto result = scn::scan("123", fmt))
+ *     int value = result->value();
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename = std::enable_if_t<detail::is_file_or_narrow_range<Source>>>
+SCN_NODISCARD auto scan(Source&& source, const compiled_format<Args...>& format)
+    -> scan_result_type<Source, Args...>
+{
+    auto args = make_scan_args<scan_context, Args...>();
+    auto result = vscan_compiled(SCN_FWD(source), format, args);
+    return make_scan_result(SCN_MOVE(result), SCN_MOVE(args.args()));
+}
+
+/**
+ * `scan` using a format string created with `SCN_COMPILE`.
+ *
+ * The format string is checked and parsed at compile time.
+ * If `source` is contiguous, and all of `Args` are builtin types, the
+ * arguments aren't type-erased: every value is read directly with the reader
+ * for its type. Otherwise, scanning is done like with a `compiled_format`.
+ *
+ * \code{.cpp}
+ * auto result = scn::scan<int, int>("1 ff", SCN_COMPILE("{} {:x}"));
+ * // result->values() == {1, 255}
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename Str,
+          typename = std::enable_if_t<detail::is_compiled_string_v<Str>>>
+SCN_NODISCARD auto scan(Source&& source, Str format)
+    -> scan_result_type<Source, Args...>
+{
+    using char_type = typename Str::char_type;
+    using compiled_type = detail::static_compiled_format<Str, Args...>;
+    using buffer_type = decltype(detail::make_scan_buffer(source));
+
+    detail::check_format_string<Source, Args...>(format);
+
+    if constexpr (std::is_same_v<buffer_type,
+                                 std::basic_string_view<char_type>> &&
+                  compiled_type::is_static) {
+        std::tuple<Args...> values{};
+        auto n = compiled_type::scan(detail::make_scan_buffer(source), values);
+        if (SCN_UNLIKELY(!n)) {
+            return unexpected(n.error());
+        }
+        return scan_result{detail::make_vscan_result_range(SCN_FWD(source), *n),
+                           SCN_MOVE(values)};
+    }
+    else {
+        using context_type = basic_scan_context<char_type>;
+        auto args = make_scan_args<context_type, Args...>();
+        auto result = detail::vscan_compiled_generic(
+            SCN_FWD(source), compiled_type::view(),
+            basic_scan_args<context_type>{args});
+        return make_scan_result(SCN_MOVE(result), SCN_MOVE(args.args()));
+    }
+}
+
 /**
  * \defgroup locale Localization
  *
@@ -9003,6 +10483,204 @@ SCN_NODISCARD auto scan_value(Source&& source, T initial_value)
     return scan_result{SCN_MOVE(it), std::tuple{SCN_MOVE(initial_value)}};
 }
 
+/**
+ * The return type of `scan_all`.
+ *
+ * \ingroup scan
+ */
+template <typename Source, typename OutputIt>
+struct scan_all_result {
+    /// The unused input. Begins at the record that failed to scan,
+    /// or is empty, if the entire input was consumed.
+    detail::borrowed_tail_subrange_t<Source> range;
+    /// Output iterator, pointing past the last written value
+    OutputIt out;
+    /// Number of values scanned and written to `out`
+    std::size_t count;
+    /// The error that stopped scanning, or `scan_error::good`,
+    /// if the entire input was consumed
+    scan_error error;
+};
+
+namespace detail {
+template <typename Container, typename T, typename = void>
+inline constexpr bool is_scan_all_container = false;
+template <typename Container, typename T>
+inline constexpr bool is_scan_all_container<
+    Container,
+    T,
+    std::void_t<decltype(SCN_DECLVAL(Container&).push_back(SCN_DECLVAL(T)))>> =
+    true;
+
+template <typename T, typename OutputIt>
+struct scan_all_sink {
+    static void call(void* data)
+    {
+        auto& self = *static_cast<scan_all_sink*>(data);
+        *self.out = SCN_MOVE(*self.value);
+        ++self.out;
+    }
+
+    OutputIt out;
+    T* value;
+};
+}  // namespace detail
+
+/**
+ * Scan every value of type `T` from `source`, according to `format`,
+ * writing them to `out`.
+ *
+ * `format` is applied repeatedly, until either the entire `source` has
+ * been consumed, or a value fails to scan. Trailing whitespace at the end
+ * of `source` is ignored.
+ *
+ * Faster than calling `scan` in a loop, because the scanning context and
+ * the argument store are set up only once.
+ *
+ * \code{.cpp}
+ * std::vector<int> values;
+ * auto result = scn::scan_all<int>("1 2 3", "{}", values);
+ * // result.count == 3, values == {1, 2, 3}
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <
+    typename T,
+    typename Source,
+    typename OutputIt,
+    std::enable_if_t<detail::is_file_or_narrow_range<Source> &&
+                     ranges::contiguous_range<Source> &&
+                     ranges::sized_range<Source> &&
+                     !detail::is_scan_all_container<OutputIt, T>>* = nullptr>
+SCN_NODISCARD auto scan_all(Source&& source,
+                            scan_format_string<Source, T> format,
+                            OutputIt out) -> scan_all_result<Source, OutputIt>
+{
+    auto args = make_scan_args<scan_context, T>();
+    auto sink =
+        detail::scan_all_sink<T, OutputIt>{SCN_MOVE(out),
+                                           &std::get<0>(args.args())};
+
+    auto r = detail::vscan_all_impl(
+        detail::make_string_view_from_pointers(
+            ranges::data(source),
+            detail::to_address(detail::make_vscan_result_range_end(source))),
+        format, args, &detail::scan_all_sink<T, OutputIt>::call, &sink);
+    return {detail::make_vscan_result_range(SCN_FWD(source), r.position),
+            SCN_MOVE(sink.out), r.count, r.error};
+}
+
+/**
+ * `scan_all`, appending the scanned values to `container`
+ * with `push_back`.
+ *
+ * \ingroup scan
+ */
+template <
+    typename T,
+    typename Source,
+    typename Container,
+    std::enable_if_t<detail::is_file_or_narrow_range<Source> &&
+                     ranges::contiguous_range<Source> &&
+                     ranges::sized_range<Source> &&
+                     detail::is_scan_all_container<Container, T>>* = nullptr>
+SCN_NODISCARD auto scan_all(Source&& source,
+                            scan_format_string<Source, T> format,
+                            Container& container)
+    -> scan_all_result<Source, std::back_insert_iterator<Container>>
+{
+    return scan_all<T>(SCN_FWD(source), format, std::back_inserter(container));
+}
+
+/**
+ * The return type of `scan_columns`.
+ *
+ * \ingroup scan
+ */
+template <typename Source>
+struct scan_columns_result {
+    /// The unused input. Begins at the record that failed to scan,
+    /// or is empty, if the entire input was consumed.
+    detail::borrowed_tail_subrange_t<Source> range;
+    /// Number of records scanned, and appended to every column
+    std::size_t count;
+    /// The error that stopped scanning, or `scan_error::good`,
+    /// if the entire input was consumed
+    scan_error error;
+};
+
+namespace detail {
+template <typename Tuple, typename... Columns>
+struct scan_columns_sink {
+    static void call(void* data)
+    {
+        auto& self = *static_cast<scan_columns_sink*>(data);
+        self.push(std::index_sequence_for<Columns...>{});
+    }
+
+    template <std::size_t... I>
+    void push(std::index_sequence<I...>)
+    {
+        (std::get<I>(columns).push_back(SCN_MOVE(std::get<I>(*values))), ...);
+    }
+
+    std::tuple<Columns&...> columns;
+    Tuple* values;
+};
+}  // namespace detail
+
+/**
+ * Scan records of `Args...` from `source`, according to `format`,
+ * appending every scanned value to its own column: a container with
+ * `push_back`, like `std::vector`. `columns` are given in the same order as
+ * `Args`.
+ *
+ * Like `scan_all`, `format` is applied repeatedly, until either the entire
+ * `source` has been consumed, or a record fails to scan. Only complete
+ * records are appended to the columns, so all of them will have the same
+ * number of values appended, `scan_columns_result::count`.
+ *
+ * \code{.cpp}
+ * std::vector<int> ids;
+ * std::vector<double> prices;
+ * auto result = scn::scan_columns<int, double>(
+ *     "1 2.5\n2 3.75\n", "{} {}", ids, prices);
+ * // result.count == 2, ids == {1, 2}, prices == {2.5, 3.75}
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename... Args,
+          typename Source,
+          typename... Columns,
+          std::enable_if_t<detail::is_file_or_narrow_range<Source> &&
+                           ranges::contiguous_range<Source> &&
+                           ranges::sized_range<Source>>* = nullptr>
+SCN_NODISCARD auto scan_columns(Source&& source,
+                                scan_format_string<Source, Args...> format,
+                                Columns&... columns)
+    -> scan_columns_result<Source>
+{
+    static_assert(sizeof...(Args) == sizeof...(Columns),
+                  "scan_columns: every argument needs exactly one column");
+    static_assert((detail::is_scan_all_container<Columns, Args> && ...),
+                  "scan_columns: columns need to be containers with "
+                  "push_back(Arg), like std::vector<Arg>");
+
+    auto args = make_scan_args<scan_context, Args...>();
+    using sink_type = detail::scan_columns_sink<std::tuple<Args...>, Columns...>;
+    auto sink = sink_type{{columns...}, &args.args()};
+
+    auto r = detail::vscan_all_impl(
+        detail::make_string_view_from_pointers(
+            ranges::data(source),
+            detail::to_address(detail::make_vscan_result_range_end(source))),
+        format, args, &sink_type::call, &sink);
+    return {detail::make_vscan_result_range(SCN_FWD(source), r.position),
+            r.count, r.error};
+}
+
 /**
  * Scan from `stdin`.
  *
@@ -9041,6 +10719,84 @@ SCN_NODISCARD auto prompt(const char* msg,
     return input<Args...>(format);
 }
 
+/**
+ * Persistent reader of `stdin`, for programs doing a large number of small
+ * reads from it.
+ *
+ * `input()` locks `stdin`, and gives back the characters it read but didn't
+ * consume, on every call.
+ * Instead, `stdin_reader` keeps `stdin` locked, and its buffered input
+ * around, across calls. The consumed input is synchronized with `stdin` only
+ * when the reader is flushed, either by calling `flush()`, or by the end of
+ * the calling thread.
+ * Until then, `stdin` must not be read by other means
+ * (like `std::scanf`, `std::cin`, or `scn::input`).
+ *
+ * \code{.cpp}
+ * auto& reader = scn::stdin_reader::get();
+ * for (int i = 0; i < n; ++i) {
+ *     auto result = reader.input<int>("{}");
+ *     // ...
+ * }
+ * reader.flush();
+ * \endcode
+ *
+ * \ingroup scan
+ */
+class stdin_reader {
+public:
+    stdin_reader(const stdin_reader&) = delete;
+    stdin_reader& operator=(const stdin_reader&) = delete;
+    stdin_reader(stdin_reader&&) = delete;
+    stdin_reader& operator=(stdin_reader&&) = delete;
+    ~stdin_reader();
+
+    /// Returns the reader of the calling thread
+    static stdin_reader& get();
+
+    /// Like `scn::input()`, but doesn't synchronize with `stdin`
+    template <typename... Args>
+    SCN_NODISCARD auto input(scan_format_string<std::FILE*, Args...> format)
+        -> scan_result_type<std::FILE*, Args...>
+    {
+        auto args = make_scan_args<scan_context, Args...>();
+        auto err = vinput(format, args);
+        if (SCN_UNLIKELY(!err)) {
+            return unexpected(err);
+        }
+        return scan_result{stdin, SCN_MOVE(args.args())};
+    }
+
+    /// Like `scn::prompt()`, but doesn't synchronize with `stdin`
+    template <typename... Args>
+    SCN_NODISCARD auto prompt(const char* msg,
+                              scan_format_string<std::FILE*, Args...> format)
+        -> scan_result_type<std::FILE*, Args...>
+    {
+        std::printf("%s", msg);
+        std::fflush(stdout);
+        return input<Args...>(format);
+    }
+
+    /// Type-erased implementation of `input()`.
+    /// On failure, nothing is consumed.
+    scan_error vinput(std::string_view format, scan_args args);
+
+    /**
+     * Synchronize `stdin` with the consumed input, and unlock it.
+     *
+     * After this, `stdin` can be read by other means.
+     * The next call to `input()` locks it again.
+     */
+    void flush();
+
+private:
+    stdin_reader() = default;
+
+    std::optional<detail::scan_file_buffer> m_buffer{std::nullopt};
+    std::ptrdiff_t m_position{0};
+};
+
 namespace detail {
 template <typename T>
 inline constexpr bool is_scan_int_type =
@@ -9102,5 +10858,114 @@ SCN_NODISCARD auto scan_int_exhaustive_valid(std::string_view source) -> T
     return detail::scan_int_exhaustive_valid_impl<T>(source);
 }
 
+/**
+ * The return type of `scan_int_array`.
+ *
+ * \ingroup scan
+ */
+template <typename OutputIt>
+struct scan_int_array_result {
+    /// The unused input. Begins at the value that failed to parse,
+    /// at the first character after a value that isn't the delimiter,
+    /// or is empty, if the entire input was consumed.
+    detail::borrowed_tail_subrange_t<std::string_view> range;
+    /// Output iterator, pointing past the last written value
+    OutputIt out;
+    /// Number of values parsed and written to `out`
+    std::size_t count;
+    /// The error that stopped parsing, or `scan_error::good`
+    scan_error error;
+};
+
+namespace detail {
+inline constexpr std::size_t scan_int_array_chunk_size = 256;
+
+template <typename OutputIt, typename T, typename = void>
+inline constexpr bool is_scan_int_array_output_iterator = false;
+template <typename OutputIt, typename T>
+inline constexpr bool is_scan_int_array_output_iterator<
+    OutputIt,
+    T,
+    std::void_t<decltype(*SCN_DECLVAL(OutputIt&) = SCN_DECLVAL(T)),
+                decltype(++SCN_DECLVAL(OutputIt&))>> = true;
+}  // namespace detail
+
+/**
+ * Fast reading of an array of integers.
+ *
+ * Reads base-10 integers separated by exactly one `delimiter` from
+ * `source`, writing them to `out`, until either the entire `source` has been
+ * consumed, or something else than `delimiter` follows a value.
+ * A single trailing `delimiter` at the end of `source` is allowed.
+ * No whitespace is skipped, unless it's the `delimiter`.
+ * Values can have a leading `+` or `-` sign, but no base prefix.
+ *
+ * Parses the values in a tight loop, without constructing a `scan_result`
+ * for each of them, making this considerably faster than `scan_int` in a
+ * loop. `delimiter` must not be a digit or a sign.
+ *
+ * \code{.cpp}
+ * std::vector<int> values;
+ * auto result = scn::scan_int_array<int>("1,2,-3", ',',
+ *                                        std::back_inserter(values));
+ * // result.count == 3, values == {1, 2, -3}
+ * \endcode
+ *
+ * \ingroup scan
+ */
+template <typename T,
+          typename OutputIt,
+          std::enable_if_t<detail::is_scan_int_type<T> &&
+                           detail::is_scan_int_array_output_iterator<
+                               OutputIt,
+                               T>>* = nullptr>
+SCN_NODISCARD auto scan_int_array(std::string_view source,
+                                  char delimiter,
+                                  OutputIt out)
+    -> scan_int_array_result<OutputIt>
+{
+    T buffer[detail::scan_int_array_chunk_size];
+    std::size_t count = 0;
+    std::ptrdiff_t position = 0;
+
+    while (true) {
+        auto r = detail::scan_int_array_impl(
+            source.substr(static_cast<std::size_t>(position)), delimiter,
+            buffer, detail::scan_int_array_chunk_size);
+        for (std::size_t i = 0; i < r.count; ++i) {
+            *out = buffer[i];
+            ++out;
+        }
+        count += r.count;
+        position += r.position;
+
+        if (!r.full) {
+            return {ranges::subrange{source.begin() + position, source.end()},
+                    SCN_MOVE(out), count, r.error};
+        }
+    }
+}
+
+#if SCN_HAS_STD_SPAN
+/**
+ * `scan_int_array`, writing the values directly to `out`.
+ * Stops after `out.size()` values.
+ *
+ * \ingroup scan
+ */
+template <typename T, std::enable_if_t<detail::is_scan_int_type<T>>* = nullptr>
+SCN_NODISCARD auto scan_int_array(std::string_view source,
+                                  char delimiter,
+                                  std::span<T> out)
+    -> scan_int_array_result<typename std::span<T>::iterator>
+{
+    auto r = detail::scan_int_array_impl(source, delimiter, out.data(),
+                                         out.size());
+    return {ranges::subrange{source.begin() + r.position, source.end()},
+            out.begin() + static_cast<std::ptrdiff_t>(r.count), r.count,
+            r.error};
+}
+#endif
+
 SCN_END_NAMESPACE
 }  // namespace scn
@@ -72,6 +72,32 @@ auto vscan_value(Range&& range, basic_scan_arg<wscan_context> arg)
     return detail::vscan_value_generic(SCN_FWD(range), arg);
 }
 
+/**
+ * \ingroup xchar
+ *
+ * \see vscan_compiled()
+ */
+template <typename Range, typename... Args>
+auto vscan_compiled(Range&& range,
+                    const wcompiled_format<Args...>& format,
+                    wscan_args args) -> vscan_result<Range>
+{
+    return detail::vscan_compiled_generic(SCN_FWD(range), format.view(),
+                                          args);
+}
+
+/**
+ * \ingroup xchar
+ *
+ * \see compile_format()
+ */
+template <typename... Args>
+auto compile_format(wscan_format_string<std::wstring_view, Args...> format)
+    -> scan_expected<wcompiled_format<Args...>>
+{
+    return wcompiled_format<Args...>::compile(format.get());
+}
+
 // scan
 
 /**
@@ -150,6 +176,23 @@ SCN_NODISCARD auto scan(const Locale& loc,
     return make_scan_result(SCN_MOVE(result), SCN_MOVE(args.args()));
 }
 
+/**
+ * \ingroup xchar
+ *
+ * \see scan()
+ */
+template <typename... Args,
+          typename Source,
+          std::enable_if_t<detail::is_wide_range<Source>>* = nullptr>
+SCN_NODISCARD auto scan(Source&& source,
+                        const wcompiled_format<Args...>& format)
+    -> scan_result_type<Source, Args...>
+{
+    auto args = make_scan_args<wscan_context, Args...>();
+    auto result = vscan_compiled(SCN_FWD(source), format, args);
+    return make_scan_result(SCN_MOVE(result), SCN_MOVE(args.args()));
+}
+
 /**
  * \ingroup xchar
  *
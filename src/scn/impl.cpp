@@ -17,7 +17,13 @@
 
 #include <scn/impl.h>
 
+#include <atomic>
+#include <cerrno>
+#include <cfenv>
+#include <list>
 #include <locale>
+#include <memory>
+#include <unordered_map>
 
 SCN_GCC_PUSH
 SCN_GCC_IGNORE("-Wold-style-cast")
@@ -53,10 +59,18 @@ SCN_GCC_POP
 #include <charconv>
 #endif
 
-#define SCN_XLOCALE_POSIX    0
-#define SCN_XLOCALE_MSVC     1
-#define SCN_XLOCALE_OTHER    2
-#define SCN_XLOCALE_DISABLED 3
+#if !SCN_DISABLE_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#endif
+
+#define SCN_XLOCALE_POSIX     0
+#define SCN_XLOCALE_MSVC      1
+#define SCN_XLOCALE_OTHER     2
+#define SCN_XLOCALE_DISABLED  3
+#define SCN_XLOCALE_USELOCALE 4
 
 #if SCN_DISABLE_LOCALE
 #define SCN_XLOCALE SCN_XLOCALE_DISABLED
@@ -76,6 +90,13 @@ SCN_GCC_POP
 #if !((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ > 25)))
 #include <xlocale.h>
 #define SCN_XLOCALE SCN_XLOCALE_POSIX
+#elif defined(__USE_GNU)
+// glibc 2.26 removed <xlocale.h>:
+// the *_l functions are declared in the regular headers with _GNU_SOURCE
+#include <locale.h>
+#include <stdlib.h>
+#include <wchar.h>
+#define SCN_XLOCALE SCN_XLOCALE_POSIX
 #endif  // __GLIBC__ <= 2.25
 
 #elif defined(__FreeBSD_version) && __FreeBSD_version >= 1000010
@@ -86,13 +107,104 @@ SCN_GCC_POP
 
 #endif  // SCN_DISABLE_LOCALE, others
 
+#if !defined(SCN_XLOCALE) && SCN_POSIX && SCN_HAS_INCLUDE(<unistd.h>)
+// No *_l functions, but POSIX.1-2008 per-thread locales (musl, others)
+#include <unistd.h>
+#if defined(_POSIX_VERSION) && _POSIX_VERSION >= 200809L
+#include <locale.h>
+#define SCN_XLOCALE SCN_XLOCALE_USELOCALE
+#endif
+#endif
+
 #ifndef SCN_XLOCALE
 #define SCN_XLOCALE SCN_XLOCALE_OTHER
 #endif
 
+#if SCN_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// SSE2 is part of the x86-64 baseline, SSE4.1 and AVX2 are detected at runtime
+#if !SCN_DISABLE_SIMD && (defined(__x86_64__) || defined(_M_X64))
+#define SCN_HAS_X86_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define SCN_TARGET_SSE41
+#define SCN_TARGET_AVX2
+#else
+#define SCN_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define SCN_TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+#else
+#define SCN_HAS_X86_SIMD 0
+#endif
+
 namespace scn {
 SCN_BEGIN_NAMESPACE
 
+/////////////////////////////////////////////////////////////////
+// SIMD support
+/////////////////////////////////////////////////////////////////
+
+#if SCN_HAS_X86_SIMD
+namespace impl {
+namespace {
+struct x86_cpu_features {
+    bool sse41{false};
+    bool avx2{false};
+};
+
+x86_cpu_features detect_cpu_features()
+{
+    x86_cpu_features features{};
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4]{};
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+
+    __cpuid(regs, 1);
+    features.sse41 = (regs[2] & (1 << 19)) != 0;
+
+    // AVX and OSXSAVE: the OS needs to preserve the ymm registers
+    constexpr int avx_osxsave_bits = (1 << 27) | (1 << 28);
+    if (max_leaf < 7 || (regs[2] & avx_osxsave_bits) != avx_osxsave_bits ||
+        (_xgetbv(0) & 0x6) != 0x6) {
+        return features;
+    }
+
+    __cpuidex(regs, 7, 0);
+    features.avx2 = (regs[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    features.sse41 = __builtin_cpu_supports("sse4.1");
+    features.avx2 = __builtin_cpu_supports("avx2");
+#endif
+    return features;
+}
+
+const x86_cpu_features& get_cpu_features()
+{
+    static const x86_cpu_features features = detect_cpu_features();
+    return features;
+}
+
+bool cpu_has_sse41()
+{
+    return get_cpu_features().sse41;
+}
+
+bool cpu_has_avx2()
+{
+    return get_cpu_features().avx2;
+}
+}  // namespace
+}  // namespace impl
+#endif  // SCN_HAS_X86_SIMD
+
 /////////////////////////////////////////////////////////////////
 // Whitespace finders
 /////////////////////////////////////////////////////////////////
@@ -147,6 +259,143 @@ std::string_view::iterator find_classic_impl(std::string_view source,
     return detail::make_string_view_iterator(source, it);
 }
 
+#if SCN_HAS_X86_SIMD
+// The classifiers below return a bitmask, with a bit set for every byte,
+// which is either a non-ASCII code unit, or an ASCII code unit, that is
+// (FindSpace == true) or isn't (FindSpace == false) classic whitespace.
+
+template <bool FindSpace>
+uint32_t classify_classic_space_sse2(const char* p)
+{
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+    // ' ', or '\t' <= ch <= '\r' (unsigned)
+    const auto is_sp = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    const auto offset = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+    const auto is_ctrl = _mm_cmpeq_epi8(
+        _mm_min_epu8(offset, _mm_set1_epi8('\r' - '\t')), offset);
+
+    const auto space = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_or_si128(is_sp, is_ctrl)));
+    const auto nonascii = static_cast<uint32_t>(_mm_movemask_epi8(v));
+    if constexpr (FindSpace) {
+        return space | nonascii;
+    }
+    else {
+        return (~space & 0xffffu) | nonascii;
+    }
+}
+
+template <bool FindSpace>
+SCN_TARGET_AVX2 uint32_t classify_classic_space_avx2(const char* p)
+{
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+
+    const auto is_sp = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+    const auto offset = _mm256_sub_epi8(v, _mm256_set1_epi8('\t'));
+    const auto is_ctrl = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(offset, _mm256_set1_epi8('\r' - '\t')), offset);
+
+    const auto space = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_or_si256(is_sp, is_ctrl)));
+    const auto nonascii = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+    if constexpr (FindSpace) {
+        return space | nonascii;
+    }
+    else {
+        return ~space | nonascii;
+    }
+}
+
+// `it` points to a byte flagged by a classifier.
+// Returns true, if it's the one we're looking for.
+// Otherwise, it's a non-ASCII code point not matching `cp_cb`:
+// `it` is advanced past it.
+template <typename CpCb>
+bool check_classic_space_candidate(const char*& it,
+                                   const char* end,
+                                   CpCb cp_cb)
+{
+    if (is_ascii_char(*it)) {
+        return true;
+    }
+
+    auto res =
+        get_next_code_point(detail::make_string_view_from_pointers(it, end));
+    if (cp_cb(res.value)) {
+        return true;
+    }
+    it = detail::to_address(res.iterator);
+    return false;
+}
+
+// Return true, if a match was found, and `it` points to it.
+// Otherwise, `it` points to the beginning of the unprocessed tail,
+// shorter than a single vector.
+
+template <bool FindSpace, typename CpCb>
+bool find_classic_sse2(const char*& it, const char* end, CpCb cp_cb)
+{
+    while (end - it >= 16) {
+        const auto mask = classify_classic_space_sse2<FindSpace>(it);
+        if (mask == 0) {
+            it += 16;
+            continue;
+        }
+
+        it += count_trailing_zeroes(mask);
+        if (check_classic_space_candidate(it, end, cp_cb)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <bool FindSpace, typename CpCb>
+SCN_TARGET_AVX2 bool find_classic_avx2(const char*& it,
+                                       const char* end,
+                                       CpCb cp_cb)
+{
+    while (end - it >= 32) {
+        const auto mask = classify_classic_space_avx2<FindSpace>(it);
+        if (mask == 0) {
+            it += 32;
+            continue;
+        }
+
+        it += count_trailing_zeroes(mask);
+        if (check_classic_space_candidate(it, end, cp_cb)) {
+            return true;
+        }
+    }
+    return false;
+}
+#endif  // SCN_HAS_X86_SIMD
+
+template <bool FindSpace, typename CuCb, typename CpCb>
+std::string_view::iterator find_classic_dispatch(std::string_view source,
+                                                 CuCb cu_cb,
+                                                 CpCb cp_cb)
+{
+#if SCN_HAS_X86_SIMD
+    const char* it = source.data();
+    const char* const end = source.data() + source.size();
+
+    const bool found = cpu_has_avx2()
+                           ? find_classic_avx2<FindSpace>(it, end, cp_cb)
+                           : find_classic_sse2<FindSpace>(it, end, cp_cb);
+    if (found) {
+        return detail::make_string_view_iterator_from_pointer(source, it);
+    }
+
+    auto tail = detail::make_string_view_from_pointers(it, end);
+    return detail::make_string_view_iterator_from_pointer(
+        source, detail::to_address(find_classic_impl(tail, cu_cb, cp_cb)));
+#else
+    return find_classic_impl(source, cu_cb, cp_cb);
+#endif
+}
+
 bool is_decimal_digit(char ch) noexcept
 {
     static constexpr std::array<bool, 256> lookup = {
@@ -180,18 +429,107 @@ bool is_decimal_digit(char ch) noexcept
     return lookup[static_cast<size_t>(static_cast<unsigned char>(ch))];
 }
 
-std::string_view::iterator find_nondecimal_digit_simple_impl(
-    std::string_view source)
+// Index of the first byte in `word` that isn't a decimal digit, or 8.
+// Carries and borrows only propagate towards later bytes, after a byte that
+// is already flagged, so the first flagged byte is always exact.
+size_t get_index_of_first_nondecimal_digit(uint64_t word)
+{
+    const auto flags =
+        ((word + 0x4646464646464646) | (word - 0x3030303030303030)) &
+        0x8080808080808080;
+    if (flags == 0) {
+        return 8;
+    }
+    return static_cast<size_t>(count_trailing_zeroes(flags)) / 8;
+}
+
+const char* find_nondecimal_digit_swar(const char* it, const char* end)
 {
-    return std::find_if(source.begin(), source.end(),
+    while (end - it >= 8) {
+        uint64_t word{};
+        std::memcpy(&word, it, sizeof(uint64_t));
+        if constexpr (SCN_IS_BIG_ENDIAN) {
+            word = byteswap(word);
+        }
+
+        const auto idx = get_index_of_first_nondecimal_digit(word);
+        if (idx != 8) {
+            return it + idx;
+        }
+        it += 8;
+    }
+
+    return std::find_if(it, end,
                         [](char ch) noexcept { return !is_decimal_digit(ch); });
 }
+
+#if SCN_HAS_X86_SIMD
+// Return true, if a non-digit was found, and `it` points to it.
+// Otherwise, `it` points to the beginning of the unprocessed tail,
+// shorter than a single vector.
+
+bool find_nondecimal_digit_sse2(const char*& it, const char* end)
+{
+    while (end - it >= 16) {
+        const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const auto offset = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+        const auto is_digit = _mm_cmpeq_epi8(
+            _mm_min_epu8(offset, _mm_set1_epi8(9)), offset);
+        const auto mask =
+            ~static_cast<uint32_t>(_mm_movemask_epi8(is_digit)) & 0xffffu;
+        if (mask != 0) {
+            it += count_trailing_zeroes(mask);
+            return true;
+        }
+        it += 16;
+    }
+    return false;
+}
+
+SCN_TARGET_AVX2 bool find_nondecimal_digit_avx2(const char*& it,
+                                                const char* end)
+{
+    while (end - it >= 32) {
+        const auto v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+        const auto offset = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+        const auto is_digit = _mm256_cmpeq_epi8(
+            _mm256_min_epu8(offset, _mm256_set1_epi8(9)), offset);
+        const auto mask =
+            ~static_cast<uint32_t>(_mm256_movemask_epi8(is_digit));
+        if (mask != 0) {
+            it += count_trailing_zeroes(mask);
+            return true;
+        }
+        it += 32;
+    }
+    return false;
+}
+#endif  // SCN_HAS_X86_SIMD
+
+std::string_view::iterator find_nondecimal_digit_dispatch(
+    std::string_view source)
+{
+    const char* it = source.data();
+    const char* const end = source.data() + source.size();
+
+#if SCN_HAS_X86_SIMD
+    const bool found = cpu_has_avx2() ? find_nondecimal_digit_avx2(it, end)
+                                      : find_nondecimal_digit_sse2(it, end);
+    if (found) {
+        return detail::make_string_view_iterator_from_pointer(source, it);
+    }
+#endif
+
+    return detail::make_string_view_iterator_from_pointer(
+        source, find_nondecimal_digit_swar(it, end));
+}
 }  // namespace
 
 std::string_view::iterator find_classic_space_narrow_fast(
     std::string_view source)
 {
-    return find_classic_impl(
+    return find_classic_dispatch<true>(
         source, [](char ch) { return is_ascii_space(ch); },
         [](char32_t cp) { return detail::is_cp_space(cp); });
 }
@@ -199,7 +537,7 @@ std::string_view::iterator find_classic_space_narrow_fast(
 std::string_view::iterator find_classic_nonspace_narrow_fast(
     std::string_view source)
 {
-    return find_classic_impl(
+    return find_classic_dispatch<false>(
         source, [](char ch) { return !is_ascii_space(ch); },
         [](char32_t cp) { return !detail::is_cp_space(cp); });
 }
@@ -207,7 +545,7 @@ std::string_view::iterator find_classic_nonspace_narrow_fast(
 std::string_view::iterator find_nondecimal_digit_narrow_fast(
     std::string_view source)
 {
-    return find_nondecimal_digit_simple_impl(source);
+    return find_nondecimal_digit_dispatch(source);
 }
 }  // namespace impl
 
@@ -572,11 +910,7 @@ bool scan_file_buffer::fill()
 {
     SCN_EXPECT(m_file);
 
-    if (!this->m_current_view.empty()) {
-        this->m_putback_buffer.insert(this->m_putback_buffer.end(),
-                                      this->m_current_view.begin(),
-                                      this->m_current_view.end());
-    }
+    this->append_current_view_to_putback();
 
     if (file_wrapper::has_buffering()) {
         return fill_with_buffering(m_file, this->m_current_view);
@@ -604,9 +938,17 @@ void scan_file_buffer::sync(std::ptrdiff_t position)
 {
     SCN_EXPECT(m_file);
 
+    // With bounded putback storage, input before putback_offset() has been
+    // discarded, and can't be put back anymore
+    if (position < this->putback_offset()) {
+        position = this->putback_offset();
+    }
+    const auto putback_end =
+        this->putback_offset() +
+        static_cast<std::ptrdiff_t>(this->putback_buffer().size());
+
     if (file_wrapper::has_buffering()) {
-        if (position <
-            static_cast<std::ptrdiff_t>(this->putback_buffer().size())) {
+        if (position < putback_end) {
             file_unlocker_for_unget unlocker{m_file};
             auto putback_segment = this->get_segment_starting_at(position);
             for (auto rit = putback_segment.rbegin();
@@ -616,9 +958,7 @@ void scan_file_buffer::sync(std::ptrdiff_t position)
             return;
         }
 
-        file_wrapper::unsafe_advance_n(
-            m_file, position - static_cast<std::ptrdiff_t>(
-                                   this->putback_buffer().size()));
+        file_wrapper::unsafe_advance_n(m_file, position - putback_end);
         return;
     }
 
@@ -631,140 +971,518 @@ void scan_file_buffer::sync(std::ptrdiff_t position)
     SCN_EXPECT(m_current_view.size() == 1);
     file_wrapper::unget(m_file, m_current_view.front());
 
-    auto putback_segment =
-        std::string_view{this->putback_buffer()}.substr(position);
+    auto putback_segment = this->putback_buffer().substr(
+        static_cast<std::size_t>(position - this->putback_offset()));
     for (auto rit = putback_segment.rbegin(); rit != putback_segment.rend();
          ++rit) {
         file_wrapper::unget(m_file, *rit);
     }
 }
-}  // namespace detail
 
-/////////////////////////////////////////////////////////////////
-// locale implementations
-/////////////////////////////////////////////////////////////////
-
-#if !SCN_DISABLE_LOCALE
-
-namespace detail {
-template <typename Locale>
-locale_ref::locale_ref(const Locale& loc) : m_locale(&loc)
+#if SCN_POSIX
+scan_fd_buffer::scan_fd_buffer(int fd)
+    : base(base::non_contiguous_tag{}), m_fd(fd)
 {
-    static_assert(std::is_same_v<Locale, std::locale>);
+    // While pinned, blocks are retired instead of being reused
+    this->m_stable_current_view = true;
 }
 
-template <typename Locale>
-Locale locale_ref::get() const
+bool scan_fd_buffer::fill()
 {
-    static_assert(std::is_same_v<Locale, std::locale>);
-    return m_locale ? *static_cast<const std::locale*>(m_locale)
-                    : std::locale{};
-}
-
-template locale_ref::locale_ref(const std::locale&);
-template auto locale_ref::get() const -> std::locale;
-}  // namespace detail
+    this->append_current_view_to_putback();
+    this->m_current_view = {};
 
-#endif
+    // String views may point into the block: keep it alive,
+    // and read into a new one
+    if (this->is_pinned() && !m_block.empty()) {
+        this->retire_pinned_block(SCN_MOVE(m_block));
+        // Keeps its memory resource
+        m_block.clear();
+    }
 
-namespace detail {
-scan_error handle_error(scan_error e)
-{
-    return e;
-}
-}  // namespace detail
+    // m_current_view no longer points to m_block: safe to reallocate
+    if (m_block.size() != m_block_size) {
+        m_block.resize(m_block_size);
+    }
 
-/////////////////////////////////////////////////////////////////
-// Floating-point reader implementation
-/////////////////////////////////////////////////////////////////
+    ssize_t n{};
+    do {
+        n = ::read(m_fd, m_block.data(), m_block.size());
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0) {
+        return false;
+    }
 
-namespace impl {
-namespace {
-SCN_GCC_COMPAT_PUSH
-SCN_GCC_COMPAT_IGNORE("-Wfloat-equal")
-constexpr bool is_float_zero(float f)
-{
-    return f == 0.0f || f == -0.0f;
-}
-constexpr bool is_float_zero(double d)
-{
-    return d == 0.0 || d == -0.0;
+    const auto read_count = static_cast<std::size_t>(n);
+    this->m_current_view = std::string_view{m_block.data(), read_count};
+    if (read_count == m_block_size && m_block_size < max_block_size) {
+        m_block_size *= 2;
+    }
+    return true;
 }
-SCN_MAYBE_UNUSED constexpr bool is_float_zero(long double ld)
+
+void scan_fd_buffer::sync(std::ptrdiff_t position)
 {
-    return ld == 0.0L || ld == -0.0L;
+    // Bytes read from a pipe or a socket can't be given back:
+    // everything stays in the buffer, and is available for the next scan
+    // through the range returned in the result
+    m_consumed = position;
 }
-SCN_GCC_COMPAT_POP
-
-struct impl_base {
-    float_reader_base::float_kind m_kind;
-    unsigned m_options;
-};
+#endif
 
-template <typename CharT>
-struct impl_init_data {
-    contiguous_range_factory<CharT>& input;
-    float_reader_base::float_kind kind;
-    unsigned options;
+#if !SCN_DISABLE_THREADS
+struct scan_readahead_file_buffer::reader {
+    reader(std::FILE* f, std::size_t block_size) : file(f)
+    {
+        blocks[0].resize(block_size);
+        blocks[1].resize(block_size);
+        thread = std::thread{[this]() { run(); }};
+    }
 
-    constexpr impl_base base() const
+    ~reader()
     {
-        return {kind, options};
+        {
+            std::lock_guard lock{mutex};
+            stop = true;
+        }
+        cv.notify_all();
+        thread.join();
     }
-};
 
-////////////////////////////////////////////////////////////////////
-// strtod-based implementation
-// Fallback for all CharT and FloatT, if allowed
-////////////////////////////////////////////////////////////////////
+    // Background thread: fill the blocks in turn,
+    // each after the scanner has released it
+    void run()
+    {
+        std::size_t index = 0;
+        while (true) {
+            {
+                std::unique_lock lock{mutex};
+                cv.wait(lock, [&]() { return stop || !ready[index]; });
+                if (stop) {
+                    return;
+                }
+            }
 
-#if !SCN_DISABLE_STRTOD
-template <typename T>
-class strtod_impl_base : impl_base {
-protected:
-    strtod_impl_base(impl_base base) : impl_base{base} {}
+            auto& block = blocks[index];
+            const auto n = std::fread(block.data(), 1, block.size(), file);
 
-    template <typename CharT, typename Strtod>
-    scan_expected<std::ptrdiff_t> parse(T& value,
-                                        const CharT* src,
-                                        Strtod strtod_cb)
-    {
-        CharT* end{};
-        errno = 0;
-        value = strtod_cb(src, &end);
-        const auto saved_errno = errno;
-        auto chars_read = end - src;
+            {
+                std::lock_guard lock{mutex};
+                sizes[index] = n;
+                ready[index] = true;
+                // EOF or error: nothing more to read
+                done = n < block.size();
+            }
+            cv.notify_all();
 
-        if (auto e = this->check_error(chars_read, saved_errno, value);
-            SCN_UNLIKELY(!e)) {
-            return unexpected(e);
+            if (done) {
+                return;
+            }
+            index ^= 1;
         }
+    }
 
-        if (m_kind == float_reader_base::float_kind::hex_without_prefix &&
-            chars_read >= 2) {
-            chars_read -= 2;
+    // Wait until the block has been read.
+    // Returns an empty view, if there's no more input
+    std::string_view acquire(std::size_t index)
+    {
+        std::unique_lock lock{mutex};
+        cv.wait(lock, [&]() { return ready[index] || done; });
+        if (!ready[index]) {
+            return {};
         }
-
-        return chars_read;
+        return {blocks[index].data(), sizes[index]};
     }
 
-    template <typename CharT>
-    const CharT* get_null_terminated_source(
-        contiguous_range_factory<CharT>& input)
+    // Give the block back to the background thread, for reading into it
+    void release(std::size_t index)
     {
-        if (!input.stores_allocated_string()) {
-            // TODO: call float_reader::read_source?
-            auto first_space = read_until_classic_space(input.view());
-            input.assign(
-                std::basic_string<CharT>{input.view().begin(), first_space});
+        {
+            std::lock_guard lock{mutex};
+            ready[index] = false;
         }
+        cv.notify_all();
+    }
 
-        if (this->m_kind == float_reader_base::float_kind::hex_without_prefix) {
-            if constexpr (std::is_same_v<CharT, char>) {
-                input.get_allocated_string().insert(0, "0x");
-            }
-            else {
-                input.get_allocated_string().insert(0, L"0x");
+    std::FILE* file;
+    std::array<std::string, 2> blocks{};
+    std::array<std::size_t, 2> sizes{};
+    std::array<bool, 2> ready{};
+    bool done{false};
+    bool stop{false};
+
+    std::mutex mutex{};
+    std::condition_variable cv{};
+    std::thread thread{};
+};
+
+scan_readahead_file_buffer::scan_readahead_file_buffer(std::FILE* file,
+                                                       std::size_t block_size)
+    : base(base::non_contiguous_tag{}),
+      m_file(file),
+      m_start_offset(std::ftell(file))
+{
+    SCN_EXPECT(block_size > 0);
+    // Started only after the starting offset has been queried
+    m_reader = std::make_unique<reader>(file, block_size);
+}
+
+scan_readahead_file_buffer::~scan_readahead_file_buffer()
+{
+    // Stops and joins the background thread
+    m_reader.reset();
+
+    // Give back whatever was read ahead, but not consumed
+    if (m_start_offset >= 0) {
+        std::fseek(m_file, m_start_offset + static_cast<long>(m_consumed),
+                   SEEK_SET);
+    }
+}
+
+bool scan_readahead_file_buffer::fill()
+{
+    if (m_holds_block) {
+        // The block is reused by the background thread after releasing it:
+        // copy it to the putback buffer first
+        this->append_current_view_to_putback();
+        this->m_current_view = {};
+        m_reader->release(m_block_index);
+        m_block_index ^= 1;
+        m_holds_block = false;
+    }
+
+    const auto block = m_reader->acquire(m_block_index);
+    if (block.empty()) {
+        return false;
+    }
+    this->m_current_view = block;
+    m_holds_block = true;
+    return true;
+}
+
+void scan_readahead_file_buffer::sync(std::ptrdiff_t position)
+{
+    m_consumed = position;
+}
+#endif
+}  // namespace detail
+
+/////////////////////////////////////////////////////////////////
+// mapped_file implementation
+/////////////////////////////////////////////////////////////////
+
+namespace {
+#if SCN_POSIX
+bool read_whole_fd(int fd, std::string& buffer)
+{
+    constexpr std::size_t chunk_size = 64 * 1024;
+
+    std::size_t size = 0;
+    while (true) {
+        buffer.resize(size + chunk_size);
+        const auto n = ::read(fd, buffer.data() + size, chunk_size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            buffer.clear();
+            return false;
+        }
+        if (n == 0) {
+            break;
+        }
+        size += static_cast<std::size_t>(n);
+    }
+    buffer.resize(size);
+    return true;
+}
+#else
+bool read_whole_file(const char* path, std::string& buffer)
+{
+    constexpr std::size_t chunk_size = 64 * 1024;
+
+    std::FILE* file = std::fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+
+    std::size_t size = 0;
+    while (true) {
+        buffer.resize(size + chunk_size);
+        const auto n = std::fread(buffer.data() + size, 1, chunk_size, file);
+        size += n;
+        if (n < chunk_size) {
+            break;
+        }
+    }
+    const bool ok = std::ferror(file) == 0;
+    std::fclose(file);
+
+    buffer.resize(ok ? size : 0);
+    return ok;
+}
+#endif
+}  // namespace
+
+mapped_file::mapped_file(const char* path)
+{
+#if SCN_POSIX
+    const int fd = ::open(path, O_RDONLY);
+    if (fd == -1) {
+        return;
+    }
+
+    struct stat st {};
+    // Files reporting a size of zero may still have contents (procfs):
+    // those are read like pipes
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        const auto size = static_cast<std::size_t>(st.st_size);
+        void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr != MAP_FAILED) {
+            ::madvise(ptr, size, MADV_SEQUENTIAL);
+            m_data = static_cast<const char*>(ptr);
+            m_size = size;
+            m_is_mapped = true;
+            m_valid = true;
+        }
+    }
+
+    if (!m_is_mapped && read_whole_fd(fd, m_buffer)) {
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        m_valid = true;
+    }
+
+    ::close(fd);
+#else
+    if (read_whole_file(path, m_buffer)) {
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        m_valid = true;
+    }
+#endif
+}
+
+mapped_file::mapped_file(mapped_file&& other) noexcept
+    : m_data(other.m_data),
+      m_size(other.m_size),
+      m_buffer(SCN_MOVE(other.m_buffer)),
+      m_is_mapped(other.m_is_mapped),
+      m_valid(other.m_valid)
+{
+    if (!m_is_mapped) {
+        // Small strings may be stored inline: don't point to other
+        m_data = m_buffer.data();
+    }
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_is_mapped = false;
+    other.m_valid = false;
+}
+
+mapped_file& mapped_file::operator=(mapped_file&& other) noexcept
+{
+    if (this == &other) {
+        return *this;
+    }
+
+    release();
+    m_size = other.m_size;
+    m_buffer = SCN_MOVE(other.m_buffer);
+    m_is_mapped = other.m_is_mapped;
+    m_valid = other.m_valid;
+    m_data = m_is_mapped ? other.m_data : m_buffer.data();
+
+    other.m_data = nullptr;
+    other.m_size = 0;
+    other.m_is_mapped = false;
+    other.m_valid = false;
+    return *this;
+}
+
+mapped_file::~mapped_file()
+{
+    release();
+}
+
+void mapped_file::release()
+{
+#if SCN_POSIX
+    if (m_is_mapped) {
+        ::munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_buffer.clear();
+    m_is_mapped = false;
+    m_valid = false;
+}
+
+/////////////////////////////////////////////////////////////////
+// locale implementations
+/////////////////////////////////////////////////////////////////
+
+#if !SCN_DISABLE_LOCALE
+
+namespace detail {
+template <typename Locale>
+locale_ref::locale_ref(const Locale& loc) : m_locale(&loc)
+{
+    static_assert(std::is_same_v<Locale, std::locale>);
+}
+
+template <typename Locale>
+Locale locale_ref::get() const
+{
+    static_assert(std::is_same_v<Locale, std::locale>);
+    return m_locale ? *static_cast<const std::locale*>(m_locale)
+                    : std::locale{};
+}
+
+template locale_ref::locale_ref(const std::locale&);
+template auto locale_ref::get() const -> std::locale;
+}  // namespace detail
+
+#endif
+
+namespace detail {
+scan_error handle_error(scan_error e)
+{
+    return e;
+}
+}  // namespace detail
+
+/////////////////////////////////////////////////////////////////
+// Floating-point reader implementation
+/////////////////////////////////////////////////////////////////
+
+namespace impl {
+namespace {
+SCN_GCC_COMPAT_PUSH
+SCN_GCC_COMPAT_IGNORE("-Wfloat-equal")
+constexpr bool is_float_zero(float f)
+{
+    return f == 0.0f || f == -0.0f;
+}
+constexpr bool is_float_zero(double d)
+{
+    return d == 0.0 || d == -0.0;
+}
+SCN_MAYBE_UNUSED constexpr bool is_float_zero(long double ld)
+{
+    return ld == 0.0L || ld == -0.0L;
+}
+SCN_GCC_COMPAT_POP
+
+struct impl_base {
+    float_reader_base::float_kind m_kind;
+    unsigned m_options;
+};
+
+template <typename CharT>
+struct impl_init_data {
+    contiguous_range_factory<CharT>& input;
+    float_reader_base::float_kind kind;
+    unsigned options;
+
+    constexpr impl_base base() const
+    {
+        return {kind, options};
+    }
+};
+
+////////////////////////////////////////////////////////////////////
+// strtod-based implementation
+// Fallback for all CharT and FloatT, if allowed
+////////////////////////////////////////////////////////////////////
+
+#if !SCN_DISABLE_STRTOD
+// The C locale is created once, and never freed.
+// It's only ever read from, so it can be shared between threads,
+// and the process-wide locale (setlocale) is never touched.
+#if SCN_XLOCALE == SCN_XLOCALE_POSIX || \
+    SCN_XLOCALE == SCN_XLOCALE_USELOCALE
+locale_t get_cached_c_locale()
+{
+    static const locale_t loc = ::newlocale(LC_ALL_MASK, "C", locale_t{});
+    return loc;
+}
+#elif SCN_XLOCALE == SCN_XLOCALE_MSVC
+_locale_t get_cached_c_locale()
+{
+    static const _locale_t loc = ::_create_locale(LC_ALL, "C");
+    return loc;
+}
+#endif
+
+#if SCN_XLOCALE == SCN_XLOCALE_USELOCALE
+// Switches the C locale of the calling thread only
+class uselocale_classic_guard {
+public:
+    uselocale_classic_guard() : m_prev(::uselocale(get_cached_c_locale())) {}
+    ~uselocale_classic_guard()
+    {
+        ::uselocale(m_prev);
+    }
+
+    uselocale_classic_guard(const uselocale_classic_guard&) = delete;
+    uselocale_classic_guard(uselocale_classic_guard&&) = delete;
+    uselocale_classic_guard& operator=(const uselocale_classic_guard&) =
+        delete;
+    uselocale_classic_guard& operator=(uselocale_classic_guard&&) = delete;
+
+private:
+    locale_t m_prev;
+};
+#endif
+
+template <typename T>
+class strtod_impl_base : impl_base {
+protected:
+    strtod_impl_base(impl_base base) : impl_base{base} {}
+
+    template <typename CharT, typename Strtod>
+    scan_expected<std::ptrdiff_t> parse(T& value,
+                                        const CharT* src,
+                                        Strtod strtod_cb)
+    {
+        CharT* end{};
+        errno = 0;
+        value = strtod_cb(src, &end);
+        const auto saved_errno = errno;
+        auto chars_read = end - src;
+
+        if (auto e = this->check_error(chars_read, saved_errno, value);
+            SCN_UNLIKELY(!e)) {
+            return unexpected(e);
+        }
+
+        if (m_kind == float_reader_base::float_kind::hex_without_prefix &&
+            chars_read >= 2) {
+            chars_read -= 2;
+        }
+
+        return chars_read;
+    }
+
+    template <typename CharT>
+    const CharT* get_null_terminated_source(
+        contiguous_range_factory<CharT>& input)
+    {
+        if (!input.stores_allocated_string()) {
+            // TODO: call float_reader::read_source?
+            auto first_space = read_until_classic_space(input.view());
+            input.assign(
+                std::basic_string<CharT>{input.view().begin(), first_space});
+        }
+
+        if (this->m_kind == float_reader_base::float_kind::hex_without_prefix) {
+            if constexpr (std::is_same_v<CharT, char>) {
+                input.get_allocated_string().insert(0, "0x");
+            }
+            else {
+                input.get_allocated_string().insert(0, L"0x");
             }
         }
 
@@ -811,7 +1529,7 @@ protected:
     static T generic_narrow_strtod(const char* str, char** str_end)
     {
 #if SCN_XLOCALE == SCN_XLOCALE_POSIX
-        static locale_t cloc = ::newlocale(LC_ALL_MASK, "C", NULL);
+        const auto cloc = get_cached_c_locale();
         if constexpr (std::is_same_v<T, float>) {
             return ::strtof_l(str, str_end, cloc);
         }
@@ -822,7 +1540,7 @@ protected:
             return ::strtold_l(str, str_end, cloc);
         }
 #elif SCN_XLOCALE == SCN_XLOCALE_MSVC
-        static _locale_t cloc = ::_create_locale(LC_ALL, "C");
+        const auto cloc = get_cached_c_locale();
         if constexpr (std::is_same_v<T, float>) {
             return ::_strtof_l(str, str_end, cloc);
         }
@@ -832,8 +1550,12 @@ protected:
         else if constexpr (std::is_same_v<T, long double>) {
             return ::_strtold_l(str, str_end, cloc);
         }
+#else
+#if SCN_XLOCALE == SCN_XLOCALE_USELOCALE
+        uselocale_classic_guard clocale_guard{};
 #else
         set_clocale_classic_guard clocale_guard{LC_NUMERIC};
+#endif
         if constexpr (std::is_same_v<T, float>) {
             return std::strtof(str, str_end);
         }
@@ -849,7 +1571,7 @@ protected:
     static T generic_wide_strtod(const wchar_t* str, wchar_t** str_end)
     {
 #if SCN_XLOCALE == SCN_XLOCALE_POSIX
-        static locale_t cloc = ::newlocale(LC_ALL_MASK, "C", NULL);
+        const auto cloc = get_cached_c_locale();
         if constexpr (std::is_same_v<T, float>) {
             return ::wcstof_l(str, str_end, cloc);
         }
@@ -860,7 +1582,7 @@ protected:
             return ::wcstold_l(str, str_end, cloc);
         }
 #elif SCN_XLOCALE == SCN_XLOCALE_MSVC
-        static _locale_t cloc = ::_create_locale(LC_ALL, "C");
+        const auto cloc = get_cached_c_locale();
         if constexpr (std::is_same_v<T, float>) {
             return ::_wcstof_l(str, str_end, cloc);
         }
@@ -870,8 +1592,12 @@ protected:
         else if constexpr (std::is_same_v<T, long double>) {
             return ::_wcstold_l(str, str_end, cloc);
         }
+#else
+#if SCN_XLOCALE == SCN_XLOCALE_USELOCALE
+        uselocale_classic_guard clocale_guard{};
 #else
         set_clocale_classic_guard clocale_guard{LC_NUMERIC};
+#endif
         if constexpr (std::is_same_v<T, float>) {
             return std::wcstof(str, str_end);
         }
@@ -1126,28 +1852,269 @@ private:
 };
 
 ////////////////////////////////////////////////////////////////////
-// Dispatch implementation
+// Native long double implementation
+// Only for FloatT=long double, if it's x87 80-bit or IEEE binary128
 ////////////////////////////////////////////////////////////////////
 
-template <typename CharT, typename T>
-scan_expected<std::ptrdiff_t> dispatch_impl(
-    impl_init_data<CharT> data,
-    contiguous_range_factory<CharT>& nan_payload,
-    T& value)
+// fast_float doesn't support long double, and the fallbacks need to copy
+// the input into a null-terminated buffer and go through libc.
+// Decimal input that fits into the exact subset of long double arithmetic
+// (Clinger's fast path) is handled here without leaving the library.
+
+constexpr bool has_native_long_double_impl =
+    std::numeric_limits<long double>::is_iec559 &&
+    (std::numeric_limits<long double>::digits == 64 ||
+     std::numeric_limits<long double>::digits == 113);
+
+struct decimal_float_parts {
+    uint64_t mantissa{0};
+    int64_t exponent{0};
+    // nonzero digits were dropped after the 19 first significant ones
+    bool truncated{false};
+    std::ptrdiff_t length{0};
+};
+
+template <typename CharT>
+constexpr bool is_decimal_digit_code_unit(CharT ch)
 {
-    if (data.kind == float_reader_base::float_kind::inf_short) {
-        value = std::numeric_limits<T>::infinity();
-        return 3;
-    }
-    if (data.kind == float_reader_base::float_kind::inf_long) {
-        value = std::numeric_limits<T>::infinity();
-        return 8;
+    return ch >= CharT{'0'} && ch <= CharT{'9'};
+}
+
+template <typename CharT>
+decimal_float_parts parse_decimal_float_parts(
+    std::basic_string_view<CharT> input,
+    bool allow_exponent)
+{
+    constexpr int max_mantissa_digits = 19;
+
+    decimal_float_parts result{};
+    int significant_digits = 0;
+    auto it = input.begin();
+    const auto end = input.end();
+
+    auto accumulate = [&](CharT ch, bool is_fraction) {
+        const auto digit = static_cast<uint64_t>(ch - CharT{'0'});
+        if (significant_digits == 0 && digit == 0) {
+            // leading zero
+            result.exponent -= is_fraction ? 1 : 0;
+            return;
+        }
+        if (significant_digits < max_mantissa_digits) {
+            result.mantissa = result.mantissa * 10 + digit;
+            result.exponent -= is_fraction ? 1 : 0;
+            ++significant_digits;
+            return;
+        }
+        result.exponent += is_fraction ? 0 : 1;
+        result.truncated |= digit != 0;
+    };
+
+    for (; it != end && is_decimal_digit_code_unit(*it); ++it) {
+        accumulate(*it, false);
     }
-    if (data.kind == float_reader_base::float_kind::nan_simple) {
-        value = std::numeric_limits<T>::quiet_NaN();
-        return 3;
+    if (it != end && *it == CharT{'.'}) {
+        ++it;
+        for (; it != end && is_decimal_digit_code_unit(*it); ++it) {
+            accumulate(*it, true);
+        }
     }
-    if (data.kind == float_reader_base::float_kind::nan_with_payload) {
+
+    if (allow_exponent && it != end &&
+        (*it == CharT{'e'} || *it == CharT{'E'})) {
+        auto exp_it = it + 1;
+        bool exp_negative = false;
+        if (exp_it != end && (*exp_it == CharT{'+'} || *exp_it == CharT{'-'})) {
+            exp_negative = *exp_it == CharT{'-'};
+            ++exp_it;
+        }
+        if (exp_it != end && is_decimal_digit_code_unit(*exp_it)) {
+            // Saturate: anything this large is out of range anyways
+            int64_t exp_value = 0;
+            for (; exp_it != end && is_decimal_digit_code_unit(*exp_it);
+                 ++exp_it) {
+                if (exp_value < 0x10000) {
+                    exp_value = exp_value * 10 + (*exp_it - CharT{'0'});
+                }
+            }
+            result.exponent += exp_negative ? -exp_value : exp_value;
+            it = exp_it;
+        }
+    }
+
+    result.length = it - input.begin();
+    return result;
+}
+
+SCN_MAYBE_UNUSED bool long_double_rounds_to_nearest()
+{
+#ifdef FE_TONEAREST
+    return std::fegetround() == FE_TONEAREST;
+#else
+    return true;
+#endif
+}
+
+SCN_MAYBE_UNUSED bool compute_long_double_exact(uint64_t mantissa,
+                                                int64_t exponent,
+                                                long double& value)
+{
+    constexpr long double powers_of_ten[] = {
+        1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,  1e8L,  1e9L,
+        1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+        1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L, 1e28L, 1e29L,
+        1e30L, 1e31L, 1e32L, 1e33L, 1e34L, 1e35L, 1e36L, 1e37L, 1e38L, 1e39L,
+        1e40L, 1e41L, 1e42L, 1e43L, 1e44L, 1e45L, 1e46L, 1e47L, 1e48L};
+    constexpr uint64_t integer_powers_of_ten[] = {
+        1ull,
+        10ull,
+        100ull,
+        1000ull,
+        10000ull,
+        100000ull,
+        1000000ull,
+        10000000ull,
+        100000000ull,
+        1000000000ull,
+        10000000000ull,
+        100000000000ull,
+        1000000000000ull,
+        10000000000000ull,
+        100000000000000ull,
+        1000000000000000ull,
+        10000000000000000ull,
+        100000000000000000ull,
+        1000000000000000000ull,
+        10000000000000000000ull};
+    // Largest n, for which 5^n fits in the significand:
+    // then 10^n is exactly representable
+    constexpr int64_t max_exact_exponent =
+        std::numeric_limits<long double>::digits == 64 ? 27 : 48;
+
+    if (mantissa == 0) {
+        value = 0.0L;
+        return true;
+    }
+
+    // The mantissa is always exact, since it's < 2^64.
+    // Doing a single multiplication or division with exact operands
+    // yields a correctly rounded result.
+    if (exponent < 0) {
+        if (exponent < -max_exact_exponent) {
+            return false;
+        }
+        value = static_cast<long double>(mantissa) /
+                powers_of_ten[static_cast<std::size_t>(-exponent)];
+        return true;
+    }
+
+    if (exponent > max_exact_exponent) {
+        // A short mantissa may still absorb the excess exactly,
+        // e.g. 1e30 == 1000 * 10^27
+        const auto excess = exponent - max_exact_exponent;
+        if (excess >= 20) {
+            return false;
+        }
+        const auto multiplier =
+            integer_powers_of_ten[static_cast<std::size_t>(excess)];
+        if (mantissa > std::numeric_limits<uint64_t>::max() / multiplier) {
+            return false;
+        }
+        mantissa *= multiplier;
+        exponent = max_exact_exponent;
+    }
+
+    value = static_cast<long double>(mantissa) *
+            powers_of_ten[static_cast<std::size_t>(exponent)];
+    return true;
+}
+
+template <typename CharT>
+struct native_long_double_impl : impl_base {
+    native_long_double_impl(impl_init_data<CharT> data)
+        : impl_base{data.base()}, m_input(data.input)
+    {
+    }
+
+    scan_expected<std::ptrdiff_t> operator()(long double& value) const
+    {
+        if (auto n = parse_fast(value)) {
+            return *n;
+        }
+        return fast_float_fallback<CharT>({m_input, m_kind, m_options},
+                                          value);
+    }
+
+private:
+    std::optional<std::ptrdiff_t> parse_fast(long double& value) const
+    {
+        if (m_kind == float_reader_base::float_kind::hex_without_prefix ||
+            m_kind == float_reader_base::float_kind::hex_with_prefix) {
+            return std::nullopt;
+        }
+        // Only handle the default of both fixed and scientific allowed:
+        // a required exponent is left to the fallback to diagnose
+        if ((m_options & float_reader_base::allow_fixed) == 0) {
+            return std::nullopt;
+        }
+        if (!long_double_rounds_to_nearest()) {
+            return std::nullopt;
+        }
+
+        const auto parts = parse_decimal_float_parts(
+            m_input.view(),
+            (m_options & float_reader_base::allow_scientific) != 0);
+
+        long double result{};
+        if (!compute_long_double_exact(parts.mantissa, parts.exponent,
+                                       result)) {
+            return std::nullopt;
+        }
+        if (parts.truncated) {
+            // The real value is between mantissa and mantissa + 1:
+            // if both of them round to the same value, so does it
+            long double upper{};
+            if (!compute_long_double_exact(parts.mantissa + 1, parts.exponent,
+                                           upper)) {
+                return std::nullopt;
+            }
+            SCN_GCC_COMPAT_PUSH
+            SCN_GCC_COMPAT_IGNORE("-Wfloat-equal")
+            if (result != upper) {
+                return std::nullopt;
+            }
+            SCN_GCC_COMPAT_POP
+        }
+
+        value = result;
+        return parts.length;
+    }
+
+    contiguous_range_factory<CharT>& m_input;
+};
+
+////////////////////////////////////////////////////////////////////
+// Dispatch implementation
+////////////////////////////////////////////////////////////////////
+
+template <typename CharT, typename T>
+scan_expected<std::ptrdiff_t> dispatch_impl(
+    impl_init_data<CharT> data,
+    contiguous_range_factory<CharT>& nan_payload,
+    T& value)
+{
+    if (data.kind == float_reader_base::float_kind::inf_short) {
+        value = std::numeric_limits<T>::infinity();
+        return 3;
+    }
+    if (data.kind == float_reader_base::float_kind::inf_long) {
+        value = std::numeric_limits<T>::infinity();
+        return 8;
+    }
+    if (data.kind == float_reader_base::float_kind::nan_simple) {
+        value = std::numeric_limits<T>::quiet_NaN();
+        return 3;
+    }
+    if (data.kind == float_reader_base::float_kind::nan_with_payload) {
         value = std::numeric_limits<T>::quiet_NaN();
 
         // TODO: use payload
@@ -1201,6 +2168,12 @@ scan_expected<std::ptrdiff_t> dispatch_impl(
             value = tmp;
             return ret;
         }
+        else if constexpr (has_native_long_double_impl) {
+            // long doubles aren't supported by fast_float ->
+            // parse simple decimal values natively,
+            // fall back to from_chars or strtod for the rest
+            return native_long_double_impl<CharT>{data}(value);
+        }
         else {
             // long doubles aren't supported by fast_float ->
             // fall back to from_chars or strtod
@@ -1275,32 +2248,60 @@ constexpr bool is_word_made_of_eight_decimal_digits_fast(uint64_t word)
               0x8080808080808080));
 }
 
-void loop_parse_if_eight_decimal_digits(const char*& p,
-                                        const char* const end,
-                                        uint64_t& val)
+#if SCN_HAS_X86_SIMD
+// Converts sixteen decimal digits, already known to be valid
+SCN_TARGET_SSE41 uint64_t parse_sixteen_decimal_digits_sse41(const char* p)
 {
-    while (
-        std::distance(p, end) >= 8 &&
-        is_word_made_of_eight_decimal_digits_fast(get_eight_digits_word(p))) {
-        val = val * 100'000'000 + parse_eight_decimal_digits_unrolled_fast(
-                                      get_eight_digits_word(p));
-        p += 8;
-    }
+    const auto digits =
+        _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)),
+                     _mm_set1_epi8('0'));
+
+    // 8x u16: pairs of digits (pmaddubsw)
+    const auto pairs = _mm_maddubs_epi16(
+        digits, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1,
+                              10, 1));
+    // 4x u32: groups of four digits (pmaddwd)
+    const auto quads = _mm_madd_epi16(
+        pairs, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    // 2x u32: groups of eight digits (packusdw + pmaddwd)
+    const auto octets = _mm_madd_epi16(
+        _mm_packus_epi32(quads, quads),
+        _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+
+    const auto high = static_cast<uint32_t>(_mm_cvtsi128_si32(octets));
+    const auto low = static_cast<uint32_t>(_mm_extract_epi32(octets, 1));
+    return static_cast<uint64_t>(high) * 100'000'000 + low;
 }
+#endif  // SCN_HAS_X86_SIMD
 
 const char* parse_decimal_integer_fast_impl(const char* begin,
                                             const char* const end,
                                             uint64_t& val)
 {
-    loop_parse_if_eight_decimal_digits(begin, end, val);
+    // Find the end of the digit run up front,
+    // so that the loops below don't need to validate their input
+    const char* const digits_end =
+        detail::to_address(find_nondecimal_digit_narrow_fast(
+            detail::make_string_view_from_pointers(begin, end)));
+
+#if SCN_HAS_X86_SIMD
+    if (std::distance(begin, digits_end) >= 16 && cpu_has_sse41()) {
+        do {
+            val = val * 10'000'000'000'000'000 +
+                  parse_sixteen_decimal_digits_sse41(begin);
+            begin += 16;
+        } while (std::distance(begin, digits_end) >= 16);
+    }
+#endif
 
-    while (begin != end) {
-        const auto digit = char_to_int(*begin);
-        if (digit >= 10) {
-            break;
-        }
-        val = 10ull * val + static_cast<uint64_t>(digit);
-        ++begin;
+    while (std::distance(begin, digits_end) >= 8) {
+        val = val * 100'000'000 + parse_eight_decimal_digits_unrolled_fast(
+                                      get_eight_digits_word(begin));
+        begin += 8;
+    }
+
+    for (; begin != digits_end; ++begin) {
+        val = 10ull * val + static_cast<uint64_t>(*begin - '0');
     }
 
     return begin;
@@ -1501,6 +2502,50 @@ auto parse_integer_value(std::basic_string_view<CharT> source,
     return ranges::next(source.begin(), ranges::distance(source.data(), ptr));
 }
 
+template <typename T>
+auto parse_decimal_integer_fused(std::string_view source, T& value)
+    -> scan_expected<std::string_view::iterator>
+{
+    const char* p = source.data();
+    const char* const end = source.data() + source.size();
+
+    if (SCN_UNLIKELY(p == end)) {
+        return unexpected(make_eof_scan_error(eof_error::eof));
+    }
+
+    bool is_negative = false;
+    if (*p == '-') {
+        if constexpr (!std::is_signed_v<T>) {
+            return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                         "Unexpected '-' sign when parsing an "
+                                         "unsigned value");
+        }
+        is_negative = true;
+        ++p;
+    }
+    else if (*p == '+') {
+        ++p;
+    }
+
+    if (SCN_UNLIKELY(p == end)) {
+        return unexpected_scan_error(
+            scan_error::invalid_scanned_value,
+            "Failed to parse integer: No digits found");
+    }
+    if (SCN_UNLIKELY(char_to_int(*p) >= 10)) {
+        return unexpected_scan_error(scan_error::invalid_scanned_value,
+                                     "Invalid integer value");
+    }
+
+    // Skip leading zeroes, so that they don't count towards overflow
+    for (; p != end && *p == '0'; ++p) {}
+
+    SCN_TRY(ptr, parse_decimal_integer_fast(
+                     detail::make_string_view_from_pointers(p, end), value,
+                     is_negative));
+    return detail::make_string_view_iterator_from_pointer(source, ptr);
+}
+
 template <typename T>
 void parse_integer_value_exhaustive_valid(std::string_view source, T& value)
 {
@@ -1557,57 +2602,77 @@ SCN_DEFINE_INTEGER_READER_TEMPLATE(char, signed char)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, signed char)
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    signed char&);
+template auto parse_decimal_integer_fused(std::string_view, signed char&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_SHORT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, short)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, short)
 template void parse_integer_value_exhaustive_valid(std::string_view, short&);
+template auto parse_decimal_integer_fused(std::string_view, short&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_INT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, int)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, int)
 template void parse_integer_value_exhaustive_valid(std::string_view, int&);
+template auto parse_decimal_integer_fused(std::string_view, int&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_LONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, long)
 template void parse_integer_value_exhaustive_valid(std::string_view, long&);
+template auto parse_decimal_integer_fused(std::string_view, long&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_LONG_LONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, long long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, long long)
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    long long&);
+template auto parse_decimal_integer_fused(std::string_view, long long&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_UCHAR
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned char)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned char)
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned char&);
+template auto parse_decimal_integer_fused(std::string_view, unsigned char&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_USHORT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned short)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned short)
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned short&);
+template auto parse_decimal_integer_fused(std::string_view, unsigned short&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_UINT
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned int)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned int)
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned int&);
+template auto parse_decimal_integer_fused(std::string_view, unsigned int&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned long)
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned long&);
+template auto parse_decimal_integer_fused(std::string_view, unsigned long&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG_LONG
 SCN_DEFINE_INTEGER_READER_TEMPLATE(char, unsigned long long)
 SCN_DEFINE_INTEGER_READER_TEMPLATE(wchar_t, unsigned long long)
 template void parse_integer_value_exhaustive_valid(std::string_view,
                                                    unsigned long long&);
+template auto parse_decimal_integer_fused(std::string_view, unsigned long long&)
+    -> scan_expected<std::string_view::iterator>;
 #endif
 
 #undef SCN_DEFINE_INTEGER_READER_TEMPLATE
@@ -1671,9 +2736,100 @@ scan_expected<std::ptrdiff_t> scan_simple_single_argument(
     auto reader = impl::default_arg_reader<basic_scan_context<CharT>>{
         source.get(), SCN_MOVE(args), loc};
     SCN_TRY(it, visit_scan_arg(SCN_MOVE(reader), arg));
+    // Nothing before the end of the argument will be read again
+    source.release_until(it.position());
     return it.position();
 }
 
+// If `format` consists of `argcount` "{}" replacement fields, separated by a
+// single delimiter character (e.g. "{} {} {}" or "{},{},{}"), returns the
+// delimiter
+template <typename CharT>
+constexpr std::optional<CharT> get_simple_delimited_format_string_delimiter(
+    std::basic_string_view<CharT> format,
+    std::size_t argcount)
+{
+    if (argcount < 2 || format.size() != argcount * 3 - 1) {
+        return std::nullopt;
+    }
+
+    const auto delimiter = format[2];
+    if (!impl::is_ascii_char(delimiter) || delimiter == CharT{'{'} ||
+        delimiter == CharT{'}'}) {
+        return std::nullopt;
+    }
+
+    for (std::size_t i = 0; i < format.size(); i += 3) {
+        if (format[i] != CharT{'{'} || format[i + 1] != CharT{'}'}) {
+            return std::nullopt;
+        }
+        if (i + 2 < format.size() && format[i + 2] != delimiter) {
+            return std::nullopt;
+        }
+    }
+    return delimiter;
+}
+
+template <typename Range, typename CharT>
+auto match_simple_delimiter(Range range, CharT delimiter)
+    -> scan_expected<ranges::iterator_t<Range>>
+{
+    auto it = range.begin();
+    if (impl::is_range_eof(it, range.end())) {
+        return unexpected_scan_error(scan_error::invalid_format_string,
+                                     "Unexpected end of source");
+    }
+
+    // Whitespace in a format string matches any amount of whitespace
+    if (impl::is_ascii_space(delimiter)) {
+        return impl::read_while_classic_space(range);
+    }
+    if (*it != delimiter) {
+        return unexpected_scan_error(scan_error::invalid_format_string,
+                                     "Unexpected literal character in source");
+    }
+    return ranges::next(it);
+}
+
+// Equivalent to scanning with a format string accepted by
+// get_simple_delimited_format_string_delimiter, without parsing it
+template <typename Context>
+auto scan_simple_delimited_arguments(
+    typename Context::range_type source,
+    basic_scan_args<basic_scan_context<typename Context::char_type>> args,
+    typename Context::char_type delimiter,
+    detail::locale_ref loc) -> scan_expected<typename Context::iterator>
+{
+    auto it = source.begin();
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        if (i != 0) {
+            SCN_TRY_ASSIGN(it, match_simple_delimiter(
+                                   ranges::subrange{it, source.end()},
+                                   delimiter));
+        }
+
+        auto arg = args.get(i);
+        if (SCN_UNLIKELY(!arg)) {
+            return unexpected_scan_error(scan_error::invalid_format_string,
+                                         "Failed to find argument with ID");
+        }
+
+        auto reader = impl::default_arg_reader<Context>{
+            ranges::subrange{it, source.end()}, args, loc};
+        SCN_TRY_ASSIGN(it, visit_scan_arg(SCN_MOVE(reader), arg));
+
+        if constexpr (!std::is_same_v<Context,
+                                      impl::basic_contiguous_scan_context<
+                                          typename Context::char_type>>) {
+            // Nothing before the end of this argument will be read again
+            if (it.stores_parent()) {
+                it.parent()->release_until(it.position());
+            }
+        }
+    }
+    return it;
+}
+
 template <typename Context, typename ID, typename Handler>
 auto get_arg(Context& ctx, ID id, Handler& handler) ->
     typename Context::arg_type
@@ -1717,41 +2873,25 @@ private:
 };
 
 struct format_handler_base {
-    format_handler_base(size_t argcount) : args_count(argcount)
-    {
-        if (SCN_UNLIKELY(args_count >= 64)) {
-            visited_args_upper.resize((args_count - 64) / 8);
-        }
-    }
+    format_handler_base(size_t argcount) : args_count(argcount) {}
 
     void check_args_exhausted()
     {
-        {
-            const auto args_count_lower64 = args_count >= 64 ? 64 : args_count;
-            const uint64_t mask = args_count_lower64 == 64
-                                      ? std::numeric_limits<uint64_t>::max()
-                                      : (1ull << args_count_lower64) - 1;
-
-            if (visited_args_lower64 != mask) {
-                return on_error("Argument list not exhausted");
+        if (SCN_LIKELY(!visited_args_out_of_order)) {
+            if (visited_args_count != args_count) {
+                on_error("Argument list not exhausted");
             }
-        }
-
-        if (args_count < 64) {
             return;
         }
 
-        auto last_args_count = args_count - 64;
-        for (auto it = visited_args_upper.begin();
-             it != visited_args_upper.end() - 1; ++it) {
-            if (*it != std::numeric_limits<uint8_t>::max()) {
+        const auto* words = get_visited_args_words();
+        for (std::size_t i = 0; i < args_count / 64; ++i) {
+            if (words[i] != std::numeric_limits<uint64_t>::max()) {
                 return on_error("Argument list not exhausted");
             }
-            last_args_count -= 8;
         }
-
-        const auto mask = static_cast<uint8_t>(1u << last_args_count) - 1;
-        if (visited_args_upper.back() != mask) {
+        if (const auto rest = args_count % 64;
+            rest != 0 && words[args_count / 64] != (1ull << rest) - 1) {
             return on_error("Argument list not exhausted");
         }
     }
@@ -1784,12 +2924,10 @@ struct format_handler_base {
             return false;
         }
 
-        if (SCN_LIKELY(id < 64)) {
-            return (visited_args_lower64 >> id) & 1ull;
+        if (SCN_LIKELY(!visited_args_out_of_order)) {
+            return id < visited_args_count;
         }
-
-        id -= 64;
-        return (visited_args_upper[id / 8] >> (id % 8)) & 1ull;
+        return (get_visited_args_words()[id / 64] >> (id % 64)) & 1ull;
     }
 
     void set_arg_as_visited(size_t id)
@@ -1799,23 +2937,78 @@ struct format_handler_base {
             return;
         }
 
-        if (SCN_UNLIKELY(has_arg_been_visited(id))) {
+        if (SCN_LIKELY(!visited_args_out_of_order)) {
+            // Arguments visited in order (always the case with automatic
+            // indexing) are only counted
+            if (SCN_LIKELY(id == visited_args_count)) {
+                ++visited_args_count;
+                return;
+            }
+            if (id < visited_args_count) {
+                return on_error(
+                    "Argument with this ID has already been scanned");
+            }
+            track_visited_args_out_of_order();
+        }
+
+        auto& word = get_visited_args_words()[id / 64];
+        const auto bit = 1ull << (id % 64);
+        if (SCN_UNLIKELY((word & bit) != 0)) {
             return on_error("Argument with this ID has already been scanned");
         }
+        word |= bit;
+    }
 
-        if (SCN_LIKELY(id < 64)) {
-            visited_args_lower64 |= (1ull << id);
-            return;
+    void reset_visited_args()
+    {
+        if (visited_args_out_of_order) {
+            std::fill_n(get_visited_args_words(), get_visited_args_word_count(),
+                        uint64_t{0});
         }
+        visited_args_count = 0;
+        visited_args_out_of_order = false;
+    }
+
+    std::size_t get_visited_args_word_count() const
+    {
+        return (args_count + 63) / 64;
+    }
+
+    uint64_t* get_visited_args_words()
+    {
+        if (SCN_UNLIKELY(!visited_args_heap.empty())) {
+            return visited_args_heap.data();
+        }
+        return visited_args_inline.data();
+    }
 
-        id -= 64;
-        visited_args_upper[id / 8] |= (1ull << (id % 8));
+    // Switch from counting to a bitset,
+    // with the first `visited_args_count` arguments marked as visited
+    void track_visited_args_out_of_order()
+    {
+        const auto word_count = get_visited_args_word_count();
+        if (SCN_UNLIKELY(word_count > visited_args_inline.size() &&
+                         visited_args_heap.empty())) {
+            visited_args_heap.resize(word_count);
+        }
+
+        auto* words = get_visited_args_words();
+        std::fill_n(words, word_count, uint64_t{0});
+        std::fill_n(words, visited_args_count / 64,
+                    std::numeric_limits<uint64_t>::max());
+        if (const auto rest = visited_args_count % 64; rest != 0) {
+            words[visited_args_count / 64] = (1ull << rest) - 1;
+        }
+        visited_args_out_of_order = true;
     }
 
     std::size_t args_count;
     scan_error error{};
-    uint64_t visited_args_lower64{0};
-    std::vector<uint8_t> visited_args_upper{};
+    std::size_t visited_args_count{0};
+    bool visited_args_out_of_order{false};
+    // Enough for 256 arguments, more than that goes to the heap
+    std::array<uint64_t, 4> visited_args_inline{};
+    std::vector<uint64_t> visited_args_heap{};
 };
 
 template <typename CharT>
@@ -1905,6 +3098,23 @@ struct format_handler : format_handler_base {
     void on_literal_text(const char_type* begin, const char_type* end)
     {
         for (; begin != end; ++begin) {
+            if constexpr (Contiguous) {
+                // Match a run of non-whitespace ASCII text all at once
+                const auto run_end =
+                    std::find_if(begin, end, [](char_type ch) {
+                        return !impl::is_ascii_char(ch) ||
+                               impl::is_ascii_space(ch);
+                    });
+                if (run_end != begin) {
+                    if (SCN_UNLIKELY(!match_literal_run(begin, run_end))) {
+                        return;
+                    }
+                    // (-1 because of the for loop ++begin)
+                    begin = run_end - 1;
+                    continue;
+                }
+            }
+
             auto it = get_ctx().begin();
             if (impl::is_range_eof(it, get_ctx().end())) {
                 SCN_UNLIKELY_ATTR
@@ -1939,6 +3149,31 @@ struct format_handler : format_handler_base {
         }
     }
 
+    bool match_literal_run(const char_type* begin, const char_type* end)
+    {
+        const auto it = get_ctx().begin();
+        const auto run_len = static_cast<std::size_t>(end - begin);
+        const auto source_len =
+            static_cast<std::size_t>(ranges::distance(it, get_ctx().end()));
+
+        if (SCN_LIKELY(run_len <= source_len &&
+                       std::memcmp(it, begin, run_len * sizeof(char_type)) ==
+                           0)) {
+            get_ctx().advance_to(it + run_len);
+            return true;
+        }
+
+        const auto cmp_len = std::min(run_len, source_len);
+        if (std::mismatch(begin, begin + cmp_len, it).first !=
+            begin + cmp_len) {
+            on_error("Unexpected literal character in source");
+        }
+        else {
+            on_error("Unexpected end of source");
+        }
+        return false;
+    }
+
     constexpr std::size_t on_arg_id()
     {
         return parse_ctx.next_arg_id();
@@ -1964,6 +3199,13 @@ struct format_handler : format_handler_base {
         }
         else {
             get_ctx().advance_to(*r);
+            if constexpr (!Contiguous) {
+                // Nothing before the end of this argument will be read again
+                auto it = get_ctx().begin();
+                if (it.stores_parent()) {
+                    it.parent()->release_until(it.position());
+                }
+            }
         }
     }
 
@@ -2043,44 +3285,538 @@ scan_expected<std::ptrdiff_t> vscan_parse_format_string(
     return ranges::distance(beg, handler.get_ctx().begin());
 }
 
-template <typename CharT>
-scan_expected<std::ptrdiff_t> vscan_internal(
-    std::basic_string_view<CharT> source,
-    std::basic_string_view<CharT> format,
-    basic_scan_args<basic_scan_context<CharT>> args,
-    detail::locale_ref loc = {})
+template <typename Handler, typename CharT>
+void match_compiled_literal_text(Handler& handler,
+                                 const CharT* begin,
+                                 const CharT* end)
 {
-    const auto argcount = args.size();
-    if (is_simple_single_argument_format_string(format) && argcount == 1) {
-        auto arg = args.get(0);
-        return scan_simple_single_argument(source, SCN_MOVE(args), arg);
-    }
+    // Literal text in a compiled format string is a slice of the original
+    // format string, so escaped braces are still doubled
+    while (begin != end) {
+        auto brace_it = std::find_if(begin, end, [](CharT ch) {
+            return ch == CharT{'{'} || ch == CharT{'}'};
+        });
+        if (brace_it == end) {
+            return handler.on_literal_text(begin, end);
+        }
 
-    auto handler = format_handler<true, CharT>{
-        ranges::subrange<const CharT*>{source.data(),
-                                       source.data() + source.size()},
-        format, SCN_MOVE(args), SCN_MOVE(loc), argcount};
-    return vscan_parse_format_string(format, handler);
+        handler.on_literal_text(begin, brace_it + 1);
+        if (SCN_UNLIKELY(!handler)) {
+            return;
+        }
+        begin = brace_it + 2;
+    }
 }
 
-template <typename CharT>
-scan_expected<std::ptrdiff_t> vscan_internal(
-    detail::basic_scan_buffer<CharT>& buffer,
-    std::basic_string_view<CharT> format,
+template <bool Contiguous, typename CharT, typename Source>
+scan_expected<std::ptrdiff_t> vscan_compiled_execute(
+    Source&& source,
+    detail::basic_compiled_format_view<CharT> format,
     basic_scan_args<basic_scan_context<CharT>> args,
     detail::locale_ref loc = {})
 {
+    using handler_type = format_handler<Contiguous, CharT>;
+    using context_type = typename handler_type::context_type;
+
     const auto argcount = args.size();
-    if (is_simple_single_argument_format_string(format) && argcount == 1) {
-        auto arg = args.get(0);
-        return scan_simple_single_argument(buffer, SCN_MOVE(args), arg);
-    }
+    auto handler = handler_type{SCN_FWD(source), format.format,
+                                SCN_MOVE(args), SCN_MOVE(loc), argcount};
+    const auto beg = handler.get_ctx().begin();
 
-    if (buffer.is_contiguous()) {
-        auto handler = format_handler<true, CharT>{buffer.get_contiguous(),
-                                                   format, SCN_MOVE(args),
-                                                   SCN_MOVE(loc), argcount};
-        return vscan_parse_format_string(format, handler);
+    for (std::size_t i = 0; i < format.field_count; ++i) {
+        const auto& field = format.fields[i];
+        match_compiled_literal_text(handler, field.literal_begin,
+                                    field.literal_end);
+        if (SCN_UNLIKELY(!handler)) {
+            return unexpected(handler.error);
+        }
+
+        auto arg = get_arg(handler.get_ctx(), field.arg_id, handler);
+        if (!field.specs_begin) {
+            handler.on_visit_scan_arg(
+                impl::default_arg_reader<context_type>{
+                    handler.get_ctx().range(), handler.get_ctx().args(),
+                    handler.get_ctx().locale()},
+                arg);
+        }
+        else if (arg.type() == detail::arg_type::custom_type) {
+            handler.parse_ctx.advance_to(field.specs_begin);
+            handler.on_visit_scan_arg(
+                impl::custom_reader<basic_scan_context<CharT>>{
+                    handler.parse_ctx, handler.get_custom_ctx()},
+                arg);
+        }
+        else {
+            handler.on_visit_scan_arg(
+                impl::arg_reader<context_type>{handler.get_ctx().range(),
+                                               field.specs,
+                                               handler.get_ctx().locale()},
+                arg);
+        }
+        if (SCN_UNLIKELY(!handler)) {
+            return unexpected(handler.error);
+        }
+    }
+
+    match_compiled_literal_text(handler, format.trailing_literal_begin,
+                                format.trailing_literal_end);
+    if (SCN_UNLIKELY(!handler)) {
+        return unexpected(handler.error);
+    }
+    return ranges::distance(beg, handler.get_ctx().begin());
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_compiled_internal(
+    std::basic_string_view<CharT> source,
+    detail::basic_compiled_format_view<CharT> format,
+    basic_scan_args<basic_scan_context<CharT>> args)
+{
+    return vscan_compiled_execute<true>(
+        ranges::subrange<const CharT*>{source.data(),
+                                       source.data() + source.size()},
+        format, SCN_MOVE(args));
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_compiled_internal(
+    detail::basic_scan_buffer<CharT>& buffer,
+    detail::basic_compiled_format_view<CharT> format,
+    basic_scan_args<basic_scan_context<CharT>> args)
+{
+    if (buffer.is_contiguous()) {
+        return vscan_compiled_execute<true>(buffer.get_contiguous(), format,
+                                            SCN_MOVE(args));
+    }
+
+    SCN_UNLIKELY_ATTR
+    {
+        return vscan_compiled_execute<false>(buffer, format, SCN_MOVE(args));
+    }
+}
+
+/////////////////////////////////////////////////////////////////
+// Format string plan cache
+/////////////////////////////////////////////////////////////////
+
+std::atomic<std::size_t> format_plan_cache_capacity{0};
+std::atomic<std::size_t> format_plan_cache_hits{0};
+std::atomic<std::size_t> format_plan_cache_misses{0};
+
+// A parsed format string, scanned with vscan_compiled_execute
+template <typename CharT>
+struct cached_format_plan {
+    detail::basic_compiled_format_view<CharT> view() const
+    {
+        return {format, fields.data(), fields.size(), trailing_literal_begin,
+                trailing_literal_end};
+    }
+
+    // Copy of the format string, pointed to by `fields`
+    std::basic_string<CharT> format;
+    std::vector<detail::arg_type> arg_types;
+    std::vector<detail::compiled_format_field<CharT>> fields;
+    const CharT* trailing_literal_begin{nullptr};
+    const CharT* trailing_literal_end{nullptr};
+};
+
+// Like detail::compiled_format_builder,
+// but with argument types only known at runtime
+template <typename CharT>
+class cached_format_plan_builder {
+public:
+    explicit cached_format_plan_builder(cached_format_plan<CharT>& plan)
+        : m_plan(plan),
+          m_parse_ctx(plan.format),
+          m_visited_args(plan.arg_types.size(), false)
+    {
+    }
+
+    void on_literal_text(const CharT* begin, const CharT* end)
+    {
+        if (!m_literal_begin) {
+            m_literal_begin = begin;
+        }
+        m_literal_end = end;
+    }
+
+    std::size_t on_arg_id()
+    {
+        return m_parse_ctx.next_arg_id();
+    }
+    std::size_t on_arg_id(std::size_t id)
+    {
+        m_parse_ctx.check_arg_id(id);
+        return id;
+    }
+
+    void on_replacement_field(std::size_t id, const CharT*)
+    {
+        add_field(id);
+    }
+
+    const CharT* on_format_specs(std::size_t id,
+                                 const CharT* begin,
+                                 const CharT* end)
+    {
+        auto* field = add_field(id);
+        if (SCN_UNLIKELY(!field)) {
+            return begin;
+        }
+
+        auto checker = detail::specs_checker<detail::specs_setter>(
+            detail::specs_setter(field->specs), m_plan.arg_types[id]);
+        const auto specs_end = detail::parse_format_specs(begin, end, checker);
+        if (specs_end == end || *specs_end != CharT{'}'}) {
+            SCN_UNLIKELY_ATTR
+            on_error("Missing '}' in format string");
+            return begin;
+        }
+        if (auto e = checker.get_error(); SCN_UNLIKELY(!e)) {
+            on_error(e);
+            return begin;
+        }
+
+        field->specs_begin = begin;
+        field->has_specs = true;
+        return specs_end;
+    }
+
+    void check_args_exhausted()
+    {
+        if (m_field_count != m_plan.fields.size()) {
+            on_error("Argument list not exhausted");
+        }
+    }
+
+    void on_error(const char* msg)
+    {
+        SCN_UNLIKELY_ATTR
+        m_error = scan_error{scan_error::invalid_format_string, msg};
+    }
+    void on_error(scan_error err)
+    {
+        if (SCN_UNLIKELY(err != scan_error::good)) {
+            m_error = err;
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return static_cast<bool>(m_error);
+    }
+    scan_error get_error() const
+    {
+        return m_error;
+    }
+
+    void finish()
+    {
+        m_plan.trailing_literal_begin = m_literal_begin;
+        m_plan.trailing_literal_end = m_literal_end;
+    }
+
+private:
+    detail::compiled_format_field<CharT>* add_field(std::size_t id)
+    {
+        if (SCN_UNLIKELY(id >= m_plan.fields.size())) {
+            on_error("Invalid out-of-range argument ID");
+            return nullptr;
+        }
+        if (SCN_UNLIKELY(m_visited_args[id])) {
+            on_error("Argument with this ID has already been scanned");
+            return nullptr;
+        }
+        m_visited_args[id] = true;
+
+        auto& field = m_plan.fields[m_field_count++];
+        field.literal_begin = m_literal_begin;
+        field.literal_end = m_literal_end;
+        field.arg_id = id;
+        m_literal_begin = nullptr;
+        m_literal_end = nullptr;
+        return &field;
+    }
+
+    cached_format_plan<CharT>& m_plan;
+    basic_scan_parse_context<CharT> m_parse_ctx;
+    std::vector<bool> m_visited_args;
+    std::size_t m_field_count{0};
+    const CharT* m_literal_begin{nullptr};
+    const CharT* m_literal_end{nullptr};
+    scan_error m_error{};
+};
+
+// Cache of parsed format strings, keyed by their address and length.
+// Lookups only take a shared lock. Eviction approximates LRU, by giving
+// entries used since they were last considered a second chance.
+template <typename CharT>
+class format_plan_cache {
+public:
+    using plan_type = cached_format_plan<CharT>;
+    using args_type = basic_scan_args<basic_scan_context<CharT>>;
+
+    static format_plan_cache& get()
+    {
+        static format_plan_cache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const plan_type> find_or_insert(
+        std::basic_string_view<CharT> format,
+        const args_type& args)
+    {
+        const auto key = key_type{format.data(), format.size()};
+        std::shared_ptr<entry> found{};
+        {
+#if !SCN_DISABLE_THREADS
+            std::shared_lock lock{m_mutex};
+#endif
+            if (auto it = m_index.find(key); it != m_index.end()) {
+                found = *it->second;
+            }
+        }
+
+        // Compared outside of the lock: entries are immutable once inserted
+        if (found && is_plan_for(*found, format, args)) {
+            // Hits don't reorder the entries, which would need an exclusive
+            // lock, but give the entry a second chance on eviction
+            if (!found->recently_used.load(std::memory_order_relaxed)) {
+                found->recently_used.store(true, std::memory_order_relaxed);
+            }
+            format_plan_cache_hits.fetch_add(1, std::memory_order_relaxed);
+            return found;
+        }
+        format_plan_cache_misses.fetch_add(1, std::memory_order_relaxed);
+
+        auto plan = make_plan(format, args);
+        if (SCN_UNLIKELY(!plan)) {
+            return plan;
+        }
+
+#if !SCN_DISABLE_THREADS
+        std::unique_lock lock{m_mutex};
+#endif
+        if (auto it = m_index.find(key); it != m_index.end()) {
+            // Stale entry: the format string at this address has changed,
+            // or another thread inserted it after the lookup above
+            m_entries.erase(it->second);
+            m_index.erase(it);
+        }
+        m_entries.push_front(plan);
+        m_index.emplace(key, m_entries.begin());
+        evict_over_capacity();
+        return plan;
+    }
+
+    void clear()
+    {
+#if !SCN_DISABLE_THREADS
+        std::unique_lock lock{m_mutex};
+#endif
+        m_index.clear();
+        m_entries.clear();
+    }
+
+    std::size_t size()
+    {
+#if !SCN_DISABLE_THREADS
+        std::shared_lock lock{m_mutex};
+#endif
+        return m_entries.size();
+    }
+
+private:
+    struct entry : plan_type {
+        const CharT* format_address;
+        // Set on a hit, cleared when the entry gets its second chance
+        std::atomic<bool> recently_used{false};
+    };
+
+    // Evict from the back, except for entries used since they were last
+    // considered: those are moved behind the newest entry instead.
+    // The newest entry, at the front, is only evicted if the capacity is 0.
+    void evict_over_capacity()
+    {
+        const auto capacity =
+            format_plan_cache_capacity.load(std::memory_order_relaxed);
+        while (m_entries.size() > capacity) {
+            auto last = std::prev(m_entries.end());
+            if (m_entries.size() > 1 &&
+                (*last)->recently_used.exchange(false,
+                                                std::memory_order_relaxed)) {
+                m_entries.splice(std::next(m_entries.begin()), m_entries,
+                                 last);
+                continue;
+            }
+            m_index.erase(
+                key_type{(*last)->format_address, (*last)->format.size()});
+            m_entries.pop_back();
+        }
+    }
+
+    struct key_type {
+        const CharT* data;
+        std::size_t size;
+
+        bool operator==(const key_type& other) const
+        {
+            return data == other.data && size == other.size;
+        }
+    };
+    struct key_hash {
+        std::size_t operator()(const key_type& key) const
+        {
+            return std::hash<const CharT*>{}(key.data) ^ key.size;
+        }
+    };
+
+    static bool is_plan_for(const plan_type& plan,
+                            std::basic_string_view<CharT> format,
+                            const args_type& args)
+    {
+        if (plan.format != format || plan.arg_types.size() != args.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            if (plan.arg_types[i] != args.get(i).type()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static std::shared_ptr<entry> make_plan(
+        std::basic_string_view<CharT> format,
+        const args_type& args)
+    {
+        auto plan = std::make_shared<entry>();
+        plan->format_address = format.data();
+        plan->format.assign(format.data(), format.size());
+        plan->arg_types.resize(args.size());
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            plan->arg_types[i] = args.get(i).type();
+        }
+        plan->fields.resize(args.size());
+
+        auto builder = cached_format_plan_builder<CharT>{*plan};
+        if (auto e = detail::parse_format_string<false>(
+                std::basic_string_view<CharT>{plan->format}, builder);
+            SCN_UNLIKELY(!e)) {
+            return nullptr;
+        }
+        builder.finish();
+        return plan;
+    }
+
+    std::list<std::shared_ptr<entry>> m_entries;
+    std::unordered_map<key_type,
+                       typename std::list<std::shared_ptr<entry>>::iterator,
+                       key_hash>
+        m_index;
+#if !SCN_DISABLE_THREADS
+    std::shared_mutex m_mutex;
+#endif
+};
+
+// Returns nullptr, if the cache is disabled, or `format` can't be cached
+template <typename CharT>
+std::shared_ptr<const cached_format_plan<CharT>> find_cached_format_plan(
+    std::basic_string_view<CharT> format,
+    const basic_scan_args<basic_scan_context<CharT>>& args)
+{
+    if (SCN_LIKELY(format_plan_cache_capacity.load(
+                       std::memory_order_relaxed) == 0)) {
+        return nullptr;
+    }
+
+    // Custom types parse their own format specs while being scanned,
+    // so the end of their specs can't be known ahead of time
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        if (args.get(i).type() == detail::arg_type::custom_type) {
+            return nullptr;
+        }
+    }
+    return format_plan_cache<CharT>::get().find_or_insert(format, args);
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_internal(
+    std::basic_string_view<CharT> source,
+    std::basic_string_view<CharT> format,
+    basic_scan_args<basic_scan_context<CharT>> args,
+    detail::locale_ref loc = {})
+{
+    const auto argcount = args.size();
+    if (is_simple_single_argument_format_string(format) && argcount == 1) {
+        auto arg = args.get(0);
+        return scan_simple_single_argument(source, SCN_MOVE(args), arg);
+    }
+    if (const auto delimiter =
+            get_simple_delimited_format_string_delimiter(format, argcount)) {
+        const auto range = ranges::subrange<const CharT*>{
+            source.data(), source.data() + source.size()};
+        SCN_TRY(it, scan_simple_delimited_arguments<
+                        impl::basic_contiguous_scan_context<CharT>>(
+                        range, SCN_MOVE(args), *delimiter, SCN_MOVE(loc)));
+        return ranges::distance(range.begin(), it);
+    }
+    if (const auto plan = find_cached_format_plan(format, args)) {
+        return vscan_compiled_execute<true>(
+            ranges::subrange<const CharT*>{source.data(),
+                                           source.data() + source.size()},
+            plan->view(), SCN_MOVE(args), SCN_MOVE(loc));
+    }
+
+    auto handler = format_handler<true, CharT>{
+        ranges::subrange<const CharT*>{source.data(),
+                                       source.data() + source.size()},
+        format, SCN_MOVE(args), SCN_MOVE(loc), argcount};
+    return vscan_parse_format_string(format, handler);
+}
+
+template <typename CharT>
+scan_expected<std::ptrdiff_t> vscan_internal(
+    detail::basic_scan_buffer<CharT>& buffer,
+    std::basic_string_view<CharT> format,
+    basic_scan_args<basic_scan_context<CharT>> args,
+    detail::locale_ref loc = {})
+{
+    const auto argcount = args.size();
+    if (is_simple_single_argument_format_string(format) && argcount == 1) {
+        auto arg = args.get(0);
+        return scan_simple_single_argument(buffer, SCN_MOVE(args), arg);
+    }
+    if (const auto delimiter =
+            get_simple_delimited_format_string_delimiter(format, argcount)) {
+        if (buffer.is_contiguous()) {
+            const auto range = buffer.get_contiguous();
+            SCN_TRY(it, scan_simple_delimited_arguments<
+                            impl::basic_contiguous_scan_context<CharT>>(
+                            range, SCN_MOVE(args), *delimiter, SCN_MOVE(loc)));
+            return ranges::distance(range.begin(), it);
+        }
+
+        SCN_TRY(it, scan_simple_delimited_arguments<basic_scan_context<CharT>>(
+                        buffer.get(), SCN_MOVE(args), *delimiter,
+                        SCN_MOVE(loc)));
+        return it.position();
+    }
+    if (const auto plan = find_cached_format_plan(format, args)) {
+        if (buffer.is_contiguous()) {
+            return vscan_compiled_execute<true>(buffer.get_contiguous(),
+                                                plan->view(), SCN_MOVE(args),
+                                                SCN_MOVE(loc));
+        }
+        return vscan_compiled_execute<false>(buffer, plan->view(),
+                                             SCN_MOVE(args), SCN_MOVE(loc));
+    }
+
+    if (buffer.is_contiguous()) {
+        auto handler = format_handler<true, CharT>{buffer.get_contiguous(),
+                                                   format, SCN_MOVE(args),
+                                                   SCN_MOVE(loc), argcount};
+        return vscan_parse_format_string(format, handler);
     }
 
     SCN_UNLIKELY_ATTR
@@ -2091,6 +3827,99 @@ scan_expected<std::ptrdiff_t> vscan_internal(
     }
 }
 
+template <typename CharT>
+scan_expected<std::ptrdiff_t> match_compiled_literal_internal(
+    std::basic_string_view<CharT> source,
+    std::basic_string_view<CharT> literal)
+{
+    auto handler = format_handler<true, CharT>{
+        ranges::subrange<const CharT*>{source.data(),
+                                       source.data() + source.size()},
+        literal, {}, {}, 0};
+    const auto beg = handler.get_ctx().begin();
+
+    match_compiled_literal_text(handler, literal.data(),
+                                literal.data() + literal.size());
+    if (SCN_UNLIKELY(!handler)) {
+        return unexpected(handler.error);
+    }
+    return ranges::distance(beg, handler.get_ctx().begin());
+}
+
+template <typename CharT>
+detail::scan_all_impl_result vscan_all_internal(
+    std::basic_string_view<CharT> source,
+    std::basic_string_view<CharT> format,
+    basic_scan_args<basic_scan_context<CharT>> args,
+    detail::scan_all_callback on_value,
+    void* on_value_data)
+{
+    const auto argcount = args.size();
+    const bool is_simple =
+        is_simple_single_argument_format_string(format) && argcount == 1;
+    auto arg = args.get(0);
+
+    // A single context is used for the entire input,
+    // only the argument bookkeeping is reset between records
+    auto handler = format_handler<true, CharT>{
+        ranges::subrange<const CharT*>{source.data(),
+                                       source.data() + source.size()},
+        format, args, {}, argcount};
+    auto& ctx = handler.get_ctx();
+
+    detail::scan_all_impl_result result{0, 0, {}};
+    while (true) {
+        const auto record_begin = ctx.begin();
+        result.position = ranges::distance(source.data(), record_begin);
+
+        if (auto it = impl::read_while_classic_space(ctx.range());
+            it == ctx.end()) {
+            result.position = ranges::distance(source.data(), it);
+            break;
+        }
+
+        if (is_simple) {
+            if (SCN_UNLIKELY(!arg)) {
+                result.error = scan_error{scan_error::invalid_format_string,
+                                          "Argument #0 not found"};
+                break;
+            }
+            auto r = visit_scan_arg(
+                impl::default_arg_reader<
+                    impl::basic_contiguous_scan_context<CharT>>{
+                    ctx.range(), ctx.args(), ctx.locale()},
+                arg);
+            if (SCN_UNLIKELY(!r)) {
+                result.error = r.error();
+                break;
+            }
+            ctx.advance_to(*r);
+        }
+        else {
+            handler.parse_ctx =
+                typename format_handler<true, CharT>::parse_context_type{
+                    format};
+            handler.reset_visited_args();
+            if (auto r = vscan_parse_format_string(format, handler);
+                SCN_UNLIKELY(!r)) {
+                ctx.advance_to(record_begin);
+                result.error = r.error();
+                break;
+            }
+        }
+
+        if (SCN_UNLIKELY(ctx.begin() == record_begin)) {
+            result.error = scan_error{scan_error::invalid_format_string,
+                                      "Format string consumed no input"};
+            break;
+        }
+
+        on_value(on_value_data);
+        ++result.count;
+    }
+    return result;
+}
+
 template <typename Source, typename CharT>
 scan_expected<std::ptrdiff_t> vscan_value_internal(
     Source&& source,
@@ -2119,6 +3948,76 @@ auto scan_int_exhaustive_valid_impl(std::string_view source) -> T
     impl::parse_integer_value_exhaustive_valid(source, value);
     return value;
 }
+
+template <typename T>
+auto scan_int_array_impl(std::string_view source,
+                         char delimiter,
+                         T* out,
+                         std::size_t capacity) -> scan_int_array_impl_result
+{
+    SCN_EXPECT(impl::char_to_int(delimiter) >= 10 && delimiter != '-' &&
+               delimiter != '+');
+
+    const char* p = source.data();
+    const char* const end = source.data() + source.size();
+    std::size_t count = 0;
+
+    const auto make_result = [&](scan_error err, bool full) {
+        return scan_int_array_impl_result{p - source.data(), count, err, full};
+    };
+
+    while (p != end) {
+        if (count == capacity) {
+            return make_result({}, true);
+        }
+
+        const char* const value_begin = p;
+        bool is_negative = false;
+        if (*p == '-') {
+            if constexpr (!std::is_signed_v<T>) {
+                return make_result(
+                    {scan_error::invalid_scanned_value,
+                     "Unexpected '-' sign when parsing an unsigned value"},
+                    false);
+            }
+            is_negative = true;
+            ++p;
+        }
+        else if (*p == '+') {
+            ++p;
+        }
+
+        if (SCN_UNLIKELY(p == end || impl::char_to_int(*p) >= 10)) {
+            p = value_begin;
+            return make_result(
+                {scan_error::invalid_scanned_value, "Invalid integer value"},
+                false);
+        }
+
+        for (; p != end && *p == '0'; ++p) {}
+
+        uint64_t u64val{};
+        const char* const digits_end =
+            impl::parse_decimal_integer_fast_impl(p, end, u64val);
+        if (SCN_UNLIKELY(impl::check_integer_overflow<T>(
+                u64val, static_cast<std::size_t>(digits_end - p), 10,
+                is_negative))) {
+            p = value_begin;
+            return make_result(
+                {scan_error::value_out_of_range, "Integer overflow"}, false);
+        }
+
+        out[count++] = impl::store_result<T>(u64val, is_negative);
+        p = digits_end;
+
+        if (p == end || *p != delimiter) {
+            break;
+        }
+        ++p;
+    }
+
+    return make_result({}, false);
+}
 }  // namespace detail
 
 scan_error vinput(std::string_view format, scan_args args)
@@ -2133,6 +4032,64 @@ scan_error vinput(std::string_view format, scan_args args)
     return n.error();
 }
 
+void set_format_cache_capacity(std::size_t capacity)
+{
+    format_plan_cache_capacity.store(capacity, std::memory_order_relaxed);
+    format_plan_cache<char>::get().clear();
+    format_plan_cache<wchar_t>::get().clear();
+    format_plan_cache_hits.store(0, std::memory_order_relaxed);
+    format_plan_cache_misses.store(0, std::memory_order_relaxed);
+}
+
+format_cache_stats get_format_cache_stats()
+{
+    return {format_plan_cache_hits.load(std::memory_order_relaxed),
+            format_plan_cache_misses.load(std::memory_order_relaxed),
+            format_plan_cache<char>::get().size() +
+                format_plan_cache<wchar_t>::get().size(),
+            format_plan_cache_capacity.load(std::memory_order_relaxed)};
+}
+
+stdin_reader::~stdin_reader()
+{
+    flush();
+}
+
+stdin_reader& stdin_reader::get()
+{
+    static thread_local stdin_reader reader;
+    return reader;
+}
+
+scan_error stdin_reader::vinput(std::string_view format, scan_args args)
+{
+    if (!m_buffer) {
+        m_buffer.emplace(stdin);
+        m_position = 0;
+    }
+
+    // Discard the input consumed by the previous calls,
+    // but keep everything read during this one, to be able to roll back
+    m_buffer->discard_until(m_position);
+
+    auto buffer = detail::basic_scan_ref_buffer{*m_buffer, m_position};
+    auto n = vscan_internal(buffer, format, args);
+    if (SCN_UNLIKELY(!n)) {
+        return n.error();
+    }
+    m_position += *n;
+    return {};
+}
+
+void stdin_reader::flush()
+{
+    if (m_buffer) {
+        m_buffer->sync(m_position);
+        // Unlocks stdin
+        m_buffer.reset();
+    }
+}
+
 namespace detail {
 scan_expected<std::ptrdiff_t> vscan_impl(std::string_view source,
                                          std::string_view format,
@@ -2245,6 +4202,134 @@ template auto vscan_localized_impl<std::locale>(const std::locale&,
     -> scan_expected<std::ptrdiff_t>;
 #endif
 
+scan_all_impl_result vscan_all_impl(std::string_view source,
+                                    std::string_view format,
+                                    scan_args args,
+                                    scan_all_callback on_value,
+                                    void* on_value_data)
+{
+    return vscan_all_internal(source, format, args, on_value, on_value_data);
+}
+
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    std::string_view source,
+    basic_compiled_format_view<char> format,
+    scan_args args)
+{
+    return vscan_compiled_internal(source, format, args);
+}
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    scan_buffer& source,
+    basic_compiled_format_view<char> format,
+    scan_args args)
+{
+    auto n = vscan_compiled_internal(source, format, args);
+    if (SCN_LIKELY(n)) {
+        source.sync(*n);
+    }
+    else {
+        source.sync_all();
+    }
+    return n;
+}
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    std::wstring_view source,
+    basic_compiled_format_view<wchar_t> format,
+    wscan_args args)
+{
+    return vscan_compiled_internal(source, format, args);
+}
+scan_expected<std::ptrdiff_t> vscan_compiled_impl(
+    wscan_buffer& source,
+    basic_compiled_format_view<wchar_t> format,
+    wscan_args args)
+{
+    auto n = vscan_compiled_internal(source, format, args);
+    if (SCN_LIKELY(n)) {
+        source.sync(*n);
+    }
+    else {
+        source.sync_all();
+    }
+    return n;
+}
+
+scan_expected<std::ptrdiff_t> match_compiled_literal_impl(
+    std::string_view source,
+    std::string_view literal)
+{
+    return match_compiled_literal_internal(source, literal);
+}
+scan_expected<std::ptrdiff_t> match_compiled_literal_impl(
+    std::wstring_view source,
+    std::wstring_view literal)
+{
+    return match_compiled_literal_internal(source, literal);
+}
+
+template <typename T, typename CharT>
+scan_expected<std::ptrdiff_t> scan_compiled_value_impl(
+    std::basic_string_view<CharT> source,
+    T& value,
+    const format_specs* specs)
+{
+    if constexpr (!detail::is_type_disabled<T>) {
+        using context_type = impl::basic_contiguous_scan_context<CharT>;
+        const auto range = ranges::subrange<const CharT*>{
+            source.data(), source.data() + source.size()};
+
+        auto it = specs ? impl::arg_reader<context_type>{range, *specs, {}}(
+                              value)
+                        : impl::default_arg_reader<context_type>{
+                              range, {}, {}}(value);
+        if (SCN_UNLIKELY(!it)) {
+            return unexpected(it.error());
+        }
+        return *it - source.data();
+    }
+    else {
+        SCN_UNUSED(source);
+        SCN_UNUSED(value);
+        SCN_UNUSED(specs);
+        SCN_EXPECT(false);
+        SCN_UNREACHABLE;
+    }
+}
+
+#define SCN_DEFINE_SCAN_COMPILED_VALUE(T, CharT)                     \
+    template scan_expected<std::ptrdiff_t> scan_compiled_value_impl( \
+        std::basic_string_view<CharT>, T&, const format_specs*);
+
+#define SCN_DEFINE_SCAN_COMPILED_VALUE_FOR_CHAR(CharT)                   \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(wchar_t, CharT)                       \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(char32_t, CharT)                      \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(bool, CharT)                          \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(signed char, CharT)                   \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(short, CharT)                         \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(int, CharT)                           \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(long, CharT)                          \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(long long, CharT)                     \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(unsigned char, CharT)                 \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(unsigned short, CharT)                \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(unsigned int, CharT)                  \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(unsigned long, CharT)                 \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(unsigned long long, CharT)            \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(void*, CharT)                         \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(float, CharT)                         \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(double, CharT)                        \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(long double, CharT)                   \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(std::string, CharT)                   \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(std::wstring, CharT)                  \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(std::basic_string_view<CharT>, CharT) \
+    SCN_DEFINE_SCAN_COMPILED_VALUE(basic_regex_matches<CharT>, CharT)
+
+SCN_DEFINE_SCAN_COMPILED_VALUE(char, char)
+SCN_DEFINE_SCAN_COMPILED_VALUE_FOR_CHAR(char)
+SCN_DEFINE_SCAN_COMPILED_VALUE_FOR_CHAR(wchar_t)
+
+#undef SCN_DEFINE_SCAN_COMPILED_VALUE_FOR_CHAR
+#undef SCN_DEFINE_SCAN_COMPILED_VALUE
+
 scan_expected<std::ptrdiff_t> vscan_value_impl(std::string_view source,
                                                basic_scan_arg<scan_context> arg)
 {
@@ -2287,53 +4372,87 @@ scan_expected<std::ptrdiff_t> vscan_value_impl(
 template auto scan_int_impl(std::string_view, signed char&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> signed char;
+template auto scan_int_array_impl(std::string_view,
+                                  char,
+                                  signed char*,
+                                  std::size_t) -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_SHORT
 template auto scan_int_impl(std::string_view, short&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> short;
+template auto scan_int_array_impl(std::string_view, char, short*, std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_INT
 template auto scan_int_impl(std::string_view, int&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> int;
+template auto scan_int_array_impl(std::string_view, char, int*, std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_LONG
 template auto scan_int_impl(std::string_view, long&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> long;
+template auto scan_int_array_impl(std::string_view, char, long*, std::size_t)
+    -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_LONG_LONG
 template auto scan_int_impl(std::string_view, long long&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> long long;
+template auto scan_int_array_impl(std::string_view,
+                                  char,
+                                  long long*,
+                                  std::size_t) -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_UCHAR
 template auto scan_int_impl(std::string_view, unsigned char&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> unsigned char;
+template auto scan_int_array_impl(std::string_view,
+                                  char,
+                                  unsigned char*,
+                                  std::size_t) -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_USHORT
 template auto scan_int_impl(std::string_view, unsigned short&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned short;
+template auto scan_int_array_impl(std::string_view,
+                                  char,
+                                  unsigned short*,
+                                  std::size_t) -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_UINT
 template auto scan_int_impl(std::string_view, unsigned int&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> unsigned int;
+template auto scan_int_array_impl(std::string_view,
+                                  char,
+                                  unsigned int*,
+                                  std::size_t) -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG
 template auto scan_int_impl(std::string_view, unsigned long&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view) -> unsigned long;
+template auto scan_int_array_impl(std::string_view,
+                                  char,
+                                  unsigned long*,
+                                  std::size_t) -> scan_int_array_impl_result;
 #endif
 #if !SCN_DISABLE_TYPE_ULONG_LONG
 template auto scan_int_impl(std::string_view, unsigned long long&, int)
     -> scan_expected<std::string_view::iterator>;
 template auto scan_int_exhaustive_valid_impl(std::string_view)
     -> unsigned long long;
+template auto scan_int_array_impl(std::string_view,
+                                  char,
+                                  unsigned long long*,
+                                  std::size_t) -> scan_int_array_impl_result;
 #endif
 
 }  // namespace detail
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <clocale>
 #include <cmath>
+#include <cstring>
 #include <cwchar>
 #include <functional>
 #include <vector>
@@ -1007,6 +1008,26 @@ bool is_segment_contiguous(Range r)
     }
 }
 
+// If the segment ends at the end of what has been read into a scan_buffer
+// so far, the input may continue after the buffer is filled again:
+// a value reaching the end of the segment needs to be read again from the
+// whole range.
+template <typename Range>
+bool segment_may_continue(Range r)
+{
+    if constexpr (std::is_same_v<
+                      ranges::const_iterator_t<Range>,
+                      typename detail::basic_scan_buffer<
+                          detail::char_t<Range>>::forward_iterator> &&
+                  !ranges::common_range<Range>) {
+        return r.begin().stores_parent();
+    }
+    else {
+        SCN_UNUSED(r);
+        return false;
+    }
+}
+
 template <typename Range>
 std::size_t contiguous_beginning_size(Range r)
 {
@@ -1496,6 +1517,11 @@ struct string_view_wrapper {
         return false;
     }
 
+    constexpr bool owns_view() const
+    {
+        return false;
+    }
+
     [[noreturn]] string_type get_allocated_string() const
     {
         SCN_EXPECT(false);
@@ -1537,22 +1563,18 @@ public:
     contiguous_range_factory(contiguous_range_factory&& other)
         : m_storage(SCN_MOVE(other.m_storage))
     {
-        if (m_storage) {
-            m_view = *m_storage;
-        }
-        else {
-            m_view = other.m_view;
-        }
+#if SCN_HAS_MEMORY_RESOURCE
+        m_resource_storage = SCN_MOVE(other.m_resource_storage);
+#endif
+        refer_to_storage(other.m_view);
     }
     contiguous_range_factory& operator=(contiguous_range_factory&& other)
     {
         m_storage = SCN_MOVE(other.m_storage);
-        if (m_storage) {
-            m_view = *m_storage;
-        }
-        else {
-            m_view = other.m_view;
-        }
+#if SCN_HAS_MEMORY_RESOURCE
+        m_resource_storage = SCN_MOVE(other.m_resource_storage);
+#endif
+        refer_to_storage(other.m_view);
         return *this;
     }
 
@@ -1575,6 +1597,19 @@ public:
         return m_storage.has_value();
     }
 
+    /// True, if view() points to a copy owned by this object,
+    /// either in the allocated string, or in storage allocated from
+    /// the memory resource of the source buffer
+    constexpr bool owns_view() const
+    {
+#if SCN_HAS_MEMORY_RESOURCE
+        if (m_resource_storage) {
+            return true;
+        }
+#endif
+        return stores_allocated_string();
+    }
+
     string_type& get_allocated_string() &
     {
         SCN_EXPECT(stores_allocated_string());
@@ -1599,6 +1634,9 @@ public:
 
         auto& str = m_storage.emplace(m_view.data(), m_view.size());
         m_view = string_view_type{str.data(), str.size()};
+#if SCN_HAS_MEMORY_RESOURCE
+        m_resource_storage.reset();
+#endif
         return str;
     }
 
@@ -1608,6 +1646,10 @@ private:
     {
         using value_t = ranges::range_value_t<Range>;
 
+#if SCN_HAS_MEMORY_RESOURCE
+        m_resource_storage.reset();
+#endif
+
         if constexpr (ranges::borrowed_range<Range> &&
                       ranges::contiguous_range<Range> &&
                       ranges::sized_range<Range>) {
@@ -1615,7 +1657,7 @@ private:
             m_view = string_view_type{ranges::data(range), range.size()};
         }
         else if constexpr (std::is_same_v<detail::remove_cvref_t<Range>,
-                                          std::basic_string<CharT>>) {
+                                          string_type>) {
             m_storage.emplace(SCN_FWD(range));
             m_view = string_view_type{*m_storage};
         }
@@ -1627,10 +1669,15 @@ private:
             auto end_seg = range.end().contiguous_segment();
             if (SCN_UNLIKELY(detail::to_address(beg_seg.end()) !=
                              detail::to_address(end_seg.end()))) {
-                auto& str = m_storage.emplace();
-                str.reserve(range.end().position() - range.begin().position());
-                std::copy(range.begin(), range.end(), std::back_inserter(str));
-                m_view = string_view_type{str};
+#if SCN_HAS_MEMORY_RESOURCE
+                if (auto* resource = get_nondefault_resource(range.begin())) {
+                    m_storage.reset();
+                    copy_segmented_range(m_resource_storage.emplace(resource),
+                                         range);
+                    return;
+                }
+#endif
+                copy_segmented_range(m_storage.emplace(), range);
                 return;
             }
 
@@ -1657,7 +1704,54 @@ private:
         }
     }
 
+    template <typename String, typename Range>
+    void copy_segmented_range(String& str, const Range& range)
+    {
+        str.reserve(range.end().position() - range.begin().position());
+        std::copy(range.begin(), range.end(), std::back_inserter(str));
+        m_view = string_view_type{str};
+    }
+
+    void refer_to_storage(string_view_type other_view)
+    {
+        if (m_storage) {
+            m_view = *m_storage;
+            return;
+        }
+#if SCN_HAS_MEMORY_RESOURCE
+        if (m_resource_storage) {
+            m_view = *m_resource_storage;
+            return;
+        }
+#endif
+        m_view = other_view;
+    }
+
+#if SCN_HAS_MEMORY_RESOURCE
+    // The memory resource of the buffer being read from, if it's been set
+    // with set_memory_resource(), and nullptr otherwise
+    template <typename Iterator>
+    static std::pmr::memory_resource* get_nondefault_resource(
+        const Iterator& it)
+    {
+        if (!it.stores_parent()) {
+            return nullptr;
+        }
+        auto* resource = it.parent()->memory_resource();
+        if (resource == std::pmr::get_default_resource()) {
+            return nullptr;
+        }
+        return resource;
+    }
+#endif
+
     std::optional<string_type> m_storage{std::nullopt};
+#if SCN_HAS_MEMORY_RESOURCE
+    // Used instead of m_storage, when the buffer being read from allocates
+    // from a non-default memory resource
+    std::optional<detail::internal_string<CharT>> m_resource_storage{
+        std::nullopt};
+#endif
     string_view_type m_view{};
 };
 
@@ -2128,6 +2222,50 @@ auto read_while_classic_space(Range range) -> ranges::const_iterator_t<Range>
     }
 }
 
+template <typename Range>
+auto read_while_classic_decimal_digit(Range range)
+    -> ranges::const_iterator_t<Range>
+{
+    if constexpr (ranges::contiguous_range<Range> &&
+                  ranges::sized_range<Range> &&
+                  std::is_same_v<detail::char_t<Range>, char>) {
+        auto buf = make_contiguous_buffer(range);
+        auto it = find_nondecimal_digit_narrow_fast(buf.view());
+        return ranges::next(range.begin(),
+                            ranges::distance(buf.view().begin(), it));
+    }
+    else {
+        auto it = range.begin();
+
+        if constexpr (std::is_same_v<detail::char_t<Range>, char>) {
+            auto seg = get_contiguous_beginning(range);
+            if (auto seg_it = find_nondecimal_digit_narrow_fast(seg);
+                seg_it != seg.end()) {
+                return ranges::next(it, ranges::distance(seg.begin(), seg_it));
+            }
+            ranges::advance(it, seg.size());
+        }
+
+        return read_while_code_unit(
+            ranges::subrange{it, range.end()},
+            [](detail::char_t<Range> ch) noexcept {
+                return ch >= detail::char_t<Range>{'0'} &&
+                       ch <= detail::char_t<Range>{'9'};
+            });
+    }
+}
+
+template <typename Range>
+auto read_while1_classic_decimal_digit(Range range)
+    -> parse_expected<ranges::const_iterator_t<Range>>
+{
+    auto it = read_while_classic_decimal_digit(range);
+    if (it == range.begin()) {
+        return unexpected(parse_error::error);
+    }
+    return it;
+}
+
 template <typename Range>
 auto read_matching_code_unit(Range range, detail::char_t<Range> ch)
     -> parse_expected<ranges::const_iterator_t<Range>>
@@ -3357,6 +3495,13 @@ auto parse_integer_digits_without_thsep(Range range, int base)
         return range.end();
     }
     else {
+        if (base == 10) {
+            return read_while1_classic_decimal_digit(range).transform_error(
+                map_parse_error_to_scan_error(
+                    scan_error::invalid_scanned_value,
+                    "Failed to parse integer: No digits found"));
+        }
+
         return read_while1_code_unit(range,
                                      [&](char_type ch) noexcept {
                                          return char_to_int(ch) < base;
@@ -3411,13 +3556,22 @@ auto parse_integer_value(std::basic_string_view<CharT> source,
 template <typename T>
 void parse_integer_value_exhaustive_valid(std::string_view source, T& value);
 
+// Sign, digits and overflow check in one go, for a decimal value
+// with no base prefix or thousands separators
+template <typename T>
+auto parse_decimal_integer_fused(std::string_view source, T& value)
+    -> scan_expected<std::string_view::iterator>;
+
 #define SCN_DECLARE_INTEGER_READER_TEMPLATE(CharT, IntT)                    \
     extern template auto parse_integer_value(                               \
         std::basic_string_view<CharT> source, IntT& value, sign_type sign,  \
         int base)                                                           \
         -> scan_expected<typename std::basic_string_view<CharT>::iterator>; \
     extern template void parse_integer_value_exhaustive_valid(              \
-        std::string_view, IntT&);
+        std::string_view, IntT&);                                           \
+    extern template auto parse_decimal_integer_fused(std::string_view,      \
+                                                     IntT&)                 \
+        -> scan_expected<std::string_view::iterator>;
 
 #if !SCN_DISABLE_TYPE_SCHAR
 SCN_DECLARE_INTEGER_READER_TEMPLATE(char, signed char)
@@ -3478,6 +3632,18 @@ public:
     auto read_default_with_base(Range range, T& value, int base)
         -> scan_expected<ranges::const_iterator_t<Range>>
     {
+        if constexpr (ranges::contiguous_range<Range> &&
+                      ranges::sized_range<Range> &&
+                      std::is_same_v<CharT, char>) {
+            if (base == 10) {
+                auto source = detail::make_string_view_from_pointers(
+                    ranges::data(range), ranges::data(range) + range.size());
+                SCN_TRY(it, parse_decimal_integer_fused(source, value));
+                return ranges::next(range.begin(),
+                                    ranges::distance(source.begin(), it));
+            }
+        }
+
         SCN_TRY(prefix_result, parse_integer_prefix(range, base)
                                    .transform_error(make_eof_scan_error));
 
@@ -3768,8 +3934,7 @@ private:
             });
         }
 
-        return read_while1_code_unit(
-            range, [](char_type ch) noexcept { return char_to_int(ch) < 10; });
+        return read_while1_classic_decimal_digit(range);
     }
     template <typename Range>
     auto read_hex_digits(Range range, bool thsep_allowed)
@@ -4753,6 +4918,18 @@ auto read_string_impl(Range range,
     return SCN_MOVE(result);
 }
 
+template <typename Iterator>
+auto get_underlying_iterator(const Iterator& it)
+{
+    if constexpr (detail::is_specialization_of_v<Iterator,
+                                                 counted_width_iterator>) {
+        return it.base();
+    }
+    else {
+        return it;
+    }
+}
+
 template <typename Range, typename Iterator, typename ValueCharT>
 auto read_string_view_impl(Range range,
                            Iterator&& result,
@@ -4761,6 +4938,33 @@ auto read_string_view_impl(Range range,
 {
     static_assert(ranges::forward_iterator<detail::remove_cvref_t<Iterator>>);
 
+    if constexpr (std::is_same_v<
+                      detail::remove_cvref_t<decltype(get_underlying_iterator(
+                          range.begin()))>,
+                      typename detail::basic_scan_buffer<
+                          ValueCharT>::forward_iterator>) {
+        auto first = get_underlying_iterator(range.begin());
+        if (first.stores_parent()) {
+            // Non-contiguous buffer:
+            // the characters can only be referred to while it's pinned
+            auto* parent = first.parent();
+            if (!parent->is_pinned()) {
+                return unexpected_scan_error(
+                    scan_error::invalid_scanned_value,
+                    "Cannot read a string_view from this source range (not "
+                    "contiguous, and not pinned)");
+            }
+            value = parent->get_pinned_view(
+                first.position(), get_underlying_iterator(result).position());
+            if (!validate_unicode(value)) {
+                return unexpected_scan_error(
+                    scan_error::invalid_scanned_value,
+                    "Invalid encoding in scanned string_view");
+            }
+            return SCN_MOVE(result);
+        }
+    }
+
     auto src = [&]() {
         if constexpr (detail::is_specialization_of_v<Range, take_width_view>) {
             return make_contiguous_buffer(
@@ -4773,7 +4977,7 @@ auto read_string_view_impl(Range range,
     }();
     using src_type = decltype(src);
 
-    if (src.stores_allocated_string()) {
+    if (src.owns_view()) {
         return unexpected_scan_error(
             scan_error::invalid_scanned_value,
             "Cannot read a string_view from this source range (not "
@@ -5866,13 +6070,23 @@ struct default_arg_reader {
         }
         else if constexpr (!detail::is_type_disabled<T>) {
             auto rd = make_reader<T, char_type>();
-            if (!is_segment_contiguous(range)) {
+            // string_views need to be read through the buffer,
+            // to not refer to memory it might reuse
+            if (!is_segment_contiguous(range) ||
+                detail::is_specialization_of_v<T, std::basic_string_view>) {
                 return impl(rd, range, value);
             }
             auto crange = get_as_contiguous(range);
-            SCN_TRY(it, impl(rd, crange, value));
+            auto it = impl(rd, crange, value);
+            if (SCN_UNLIKELY((!it || *it == crange.end()) &&
+                             segment_may_continue(range))) {
+                return impl(rd, range, value);
+            }
+            if (SCN_UNLIKELY(!it)) {
+                return unexpected(it.error());
+            }
             return ranges::next(range.begin(),
-                                ranges::distance(crange.begin(), it));
+                                ranges::distance(crange.begin(), *it));
         }
         else {
             SCN_EXPECT(false);
@@ -6197,14 +6411,22 @@ struct arg_reader {
             }
 
             if (!is_segment_contiguous(range) || specs.precision != 0 ||
-                specs.width != 0) {
+                specs.width != 0 ||
+                detail::is_specialization_of_v<T, std::basic_string_view>) {
                 return impl(rd, range, value);
             }
 
             auto crange = get_as_contiguous(range);
-            SCN_TRY(it, impl(rd, crange, value));
+            auto it = impl(rd, crange, value);
+            if (SCN_UNLIKELY((!it || *it == crange.end()) &&
+                             segment_may_continue(range))) {
+                return impl(rd, range, value);
+            }
+            if (SCN_UNLIKELY(!it)) {
+                return unexpected(it.error());
+            }
             return ranges::next(range.begin(),
-                                ranges::distance(crange.begin(), it));
+                                ranges::distance(crange.begin(), *it));
         }
         else {
             SCN_EXPECT(false);
@@ -19,7 +19,17 @@
 
 #include <scn/scan.h>
 
+#include <algorithm>
+#include <cstdio>
 #include <deque>
+#include <list>
+#include <thread>
+#include <vector>
+
+#if SCN_POSIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using namespace std::string_view_literals;
 
@@ -101,3 +111,623 @@ TEST(ScanBufferTest, Deque2)
               "b");
     EXPECT_EQ(collect(scn::ranges::subrange{cached_it, it}), "bc");
 }
+
+TEST(ScanBufferTest, ForwardBufferFillsBlocks)
+{
+    const auto src = std::string(100, 'a') + std::string(100, 'b');
+    auto deque = std::deque<char>{src.begin(), src.end()};
+
+    auto buf = scn::detail::make_forward_scan_buffer(deque);
+    using buffer_type = decltype(buf);
+
+    ASSERT_TRUE(buf.fill());
+    EXPECT_EQ(buf.current_view(), src.substr(0, buffer_type::block_size));
+    ASSERT_TRUE(buf.fill());
+    EXPECT_EQ(buf.current_view(),
+              src.substr(buffer_type::block_size, buffer_type::block_size));
+    EXPECT_EQ(buf.putback_buffer(), src.substr(0, buffer_type::block_size));
+
+    while (buf.fill()) {}
+    EXPECT_EQ(buf.chars_available(), 200);
+    EXPECT_EQ(collect(buf.get()), src);
+}
+
+namespace {
+struct null_sentinel {
+    friend bool operator==(const char* it, null_sentinel)
+    {
+        return *it == '\0';
+    }
+    friend bool operator==(null_sentinel, const char* it)
+    {
+        return *it == '\0';
+    }
+    friend bool operator!=(const char* it, null_sentinel)
+    {
+        return *it != '\0';
+    }
+    friend bool operator!=(null_sentinel, const char* it)
+    {
+        return *it != '\0';
+    }
+};
+}  // namespace
+
+TEST(ScanBufferTest, ForwardBufferPointsToContiguousSource)
+{
+    const char* src = "foo bar";
+    auto range = scn::ranges::subrange<const char*, null_sentinel>{src, {}};
+
+    auto buf = scn::detail::make_forward_scan_buffer(range);
+    ASSERT_TRUE(buf.fill());
+    EXPECT_EQ(buf.current_view().data(), src);
+    EXPECT_EQ(buf.current_view(), "foo bar");
+    EXPECT_FALSE(buf.fill());
+}
+
+TEST(ScanBufferTest, ScanFromList)
+{
+    std::string src;
+    for (int i = 0; i < 100; ++i) {
+        src += std::to_string(i * 1000);
+        src.push_back(' ');
+    }
+    auto list = std::list<char>{src.begin(), src.end()};
+
+    auto range = scn::ranges::subrange{list};
+    for (int i = 0; i < 100; ++i) {
+        auto result = scn::scan<int>(range, "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value(), i * 1000);
+        range = scn::ranges::subrange{result->range().begin(), list.end()};
+    }
+    EXPECT_FALSE(scn::scan<int>(range, "{}"));
+}
+
+namespace {
+class chunked_buffer : public scn::detail::basic_scan_buffer<char> {
+public:
+    chunked_buffer(std::string_view data, std::size_t chunk_size)
+        : basic_scan_buffer(non_contiguous_tag{}),
+          m_data(data),
+          m_chunk_size(chunk_size)
+    {
+    }
+
+    bool fill() override
+    {
+        if (m_data.empty()) {
+            return false;
+        }
+        append_current_view_to_putback();
+        m_current_view = m_data.substr(0, m_chunk_size);
+        m_data.remove_prefix(m_current_view.size());
+        return true;
+    }
+
+private:
+    std::string_view m_data;
+    std::size_t m_chunk_size;
+};
+}  // namespace
+
+TEST(ScanBufferTest, ValuesSpanningFills)
+{
+    chunked_buffer buf{"1 23456 78 9", 4};
+    std::vector<int> values;
+    auto range = buf.get();
+    while (auto result = scn::scan<int>(range, "{}")) {
+        values.push_back(result->value());
+        range = result->range();
+    }
+    EXPECT_EQ(values, (std::vector<int>{1, 23456, 78, 9}));
+}
+
+TEST(ScanBufferTest, RefBufferSharesStorage)
+{
+    chunked_buffer buf{"abcdefghijklmnopqrstuvwxyz", 8};
+    ASSERT_TRUE(buf.fill());
+    ASSERT_TRUE(buf.fill());
+
+    scn::detail::basic_scan_ref_buffer ref{buf, 5};
+    EXPECT_EQ(ref.current_view(), "fgh");
+    EXPECT_EQ(ref.current_view().data(), buf.putback_buffer().data() + 5);
+
+    // Putback of ref is a part of the putback of buf
+    ASSERT_TRUE(ref.fill());
+    EXPECT_EQ(ref.putback_buffer(), "fgh");
+    EXPECT_EQ(ref.putback_buffer().data(), buf.putback_buffer().data() + 5);
+    EXPECT_EQ(ref.current_view(), "ijklmnop");
+
+    // Filling propagates to buf, and refers to its updated putback buffer
+    ASSERT_TRUE(ref.fill());
+    EXPECT_EQ(ref.putback_buffer(), "fghijklmnop");
+    EXPECT_EQ(ref.putback_buffer().data(), buf.putback_buffer().data() + 5);
+    EXPECT_EQ(ref.current_view(), "qrstuvwx");
+    EXPECT_EQ(ref.get_segment_starting_at(8), "nop");
+    EXPECT_EQ(ref.chars_available(), 19);
+}
+
+TEST(ScanBufferTest, Segmented)
+{
+    const std::vector<std::string_view> segments{"12", "3 4", "", "56 ", "789"};
+    scn::detail::scan_segmented_buffer buf{segments};
+
+    std::vector<int> values;
+    auto range = buf.get();
+    while (auto result = scn::scan<int>(range, "{}")) {
+        values.push_back(result->value());
+        range = result->range();
+    }
+    EXPECT_EQ(values, (std::vector<int>{123, 456, 789}));
+}
+
+TEST(ScanBufferTest, SegmentedSegmentAtATime)
+{
+    const std::string_view segments[] = {"foo ", "bar", "baz", " 1.5"};
+    scn::detail::scan_segmented_buffer buf{segments, 4};
+
+    ASSERT_TRUE(buf.fill());
+    EXPECT_EQ(buf.current_view().data(), segments[0].data());
+    ASSERT_TRUE(buf.fill());
+    EXPECT_EQ(buf.current_view().data(), segments[1].data());
+    EXPECT_EQ(buf.get_segment_starting_at(2), "o ");
+
+    auto result = scn::scan<std::string, std::string, double>(buf.get(),
+                                                             "{} {} {}");
+    ASSERT_TRUE(result);
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, "foo");
+    EXPECT_EQ(b, "barbaz");
+    EXPECT_DOUBLE_EQ(c, 1.5);
+}
+
+TEST(ScanBufferTest, PinnedSegmentedPointsToSegments)
+{
+    const std::string_view segments[] = {"foo ", "bar", "baz 1"};
+    scn::detail::scan_segmented_buffer buf{segments, 3};
+    scn::detail::scan_buffer_pin pin{buf};
+
+    auto result = scn::scan<std::string_view>(buf.get(), "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "foo");
+    EXPECT_EQ(result->value().data(), segments[0].data());
+
+    // Spans two segments: copied into storage owned by the buffer
+    auto second = scn::scan<std::string_view, int>(result->range(), "{} {}");
+    ASSERT_TRUE(second);
+    auto [str, i] = second->values();
+    EXPECT_EQ(str, "barbaz");
+    EXPECT_EQ(i, 1);
+
+    // Previously scanned views are still valid
+    EXPECT_EQ(result->value(), "foo");
+}
+
+TEST(ScanBufferTest, UnpinnedStringViewFromNonContiguousBuffer)
+{
+    const std::string_view segments[] = {"foo ", "bar"};
+    scn::detail::scan_segmented_buffer buf{segments, 2};
+
+    auto result = scn::scan<std::string_view>(buf.get(), "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(ScanBufferTest, PinnedForwardBufferKeepsValuesAcrossScans)
+{
+    std::deque<char> source;
+    for (int i = 0; i < 1000; ++i) {
+        auto str = "word" + std::to_string(i) + ' ';
+        source.insert(source.end(), str.begin(), str.end());
+    }
+    auto buf = scn::detail::make_forward_scan_buffer(source);
+    buf.set_bounded_putback(true);
+
+    std::vector<std::string_view> values;
+    {
+        scn::detail::scan_buffer_pin pin{buf};
+        auto range = buf.get();
+        while (auto result = scn::scan<std::string_view>(range, "{}")) {
+            values.push_back(result->value());
+            range = result->range();
+        }
+
+        ASSERT_EQ(values.size(), 1000u);
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_EQ(values[static_cast<std::size_t>(i)],
+                      "word" + std::to_string(i));
+        }
+    }
+    EXPECT_FALSE(buf.is_pinned());
+}
+
+#if SCN_HAS_MEMORY_RESOURCE
+namespace {
+struct counting_resource : std::pmr::memory_resource {
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        live_bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p,
+                       std::size_t bytes,
+                       std::size_t alignment) override
+    {
+        live_bytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    int allocations{0};
+    std::size_t live_bytes{0};
+};
+}  // namespace
+
+TEST(ScanBufferTest, MemoryResource)
+{
+    counting_resource resource;
+    const auto input = std::string(1000, 'a') + " 123";
+    chunked_buffer buf{input, 100};
+    buf.set_memory_resource(&resource);
+    EXPECT_EQ(buf.memory_resource(), &resource);
+
+    // Putback buffer, and the copy of the string spanning multiple chunks
+    auto result = scn::scan<std::string, int>(buf.get(), "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(result->values()), std::string(1000, 'a'));
+    EXPECT_EQ(std::get<1>(result->values()), 123);
+    EXPECT_GT(resource.allocations, 0);
+
+    // Pinned copies
+    const auto allocations = resource.allocations;
+    {
+        scn::detail::scan_buffer_pin pin{buf};
+        auto sv = buf.get_pinned_view(0, 10);
+        EXPECT_EQ(sv, std::string(10, 'a'));
+    }
+    EXPECT_GT(resource.allocations, allocations);
+}
+#endif
+
+TEST(ScanBufferTest, BoundedPutbackWithinScan)
+{
+    std::string input;
+    for (char ch : {'a', 'b', 'c', 'd'}) {
+        input.append(10000, ch);
+        input.push_back(' ');
+    }
+    chunked_buffer buf{input, 1000};
+    buf.set_bounded_putback(true);
+
+    auto result = scn::scan<std::string, std::string, std::string, std::string>(
+        buf.get(), "{} {} {} {}");
+    ASSERT_TRUE(result);
+    auto [a, b, c, d] = result->values();
+    EXPECT_EQ(a, std::string(10000, 'a'));
+    EXPECT_EQ(b, std::string(10000, 'b'));
+    EXPECT_EQ(c, std::string(10000, 'c'));
+    EXPECT_EQ(d, std::string(10000, 'd'));
+
+    EXPECT_GT(buf.putback_offset(), 0);
+    EXPECT_LT(buf.putback_buffer().size(), 20000u);
+}
+
+TEST(ScanBufferTest, BoundedPutbackAcrossScans)
+{
+    std::string input;
+    for (int i = 0; i < 20000; ++i) {
+        input += std::to_string(i);
+        input.push_back(' ');
+    }
+    chunked_buffer buf{input, 64};
+    buf.set_bounded_putback(true);
+
+    auto range = buf.get();
+    int count = 0;
+    std::size_t max_putback_size = 0;
+    while (auto result = scn::scan<int>(range, "{}")) {
+        EXPECT_EQ(result->value(), count);
+        ++count;
+        max_putback_size =
+            (std::max)(max_putback_size, buf.putback_buffer().size());
+        range = result->range();
+    }
+    EXPECT_EQ(count, 20000);
+    EXPECT_LE(max_putback_size, 8192u);
+}
+
+TEST(ScanBufferTest, UnboundedPutbackByDefault)
+{
+    chunked_buffer buf{"123 456 789", 2};
+    EXPECT_FALSE(buf.has_bounded_putback());
+
+    auto result = scn::scan<int, int, int>(buf.get(), "{} {} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->values(), std::make_tuple(123, 456, 789));
+    EXPECT_EQ(buf.putback_offset(), 0);
+    EXPECT_EQ(buf.get_segment_starting_at(0).substr(0, 4), "123 ");
+}
+
+TEST(ScanBufferTest, DequeWithLongStrings)
+{
+    const auto src = std::string(10000, 'a') + ' ' + std::string(10000, 'b');
+    auto deque = std::deque<char>{src.begin(), src.end()};
+
+    auto result = scn::scan<std::string, std::string>(deque, "{} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(result->values()), std::string(10000, 'a'));
+    EXPECT_EQ(std::get<1>(result->values()), std::string(10000, 'b'));
+}
+
+namespace {
+// Scans two strings with a nested scan, and then again,
+// from an iterator saved before the first one
+struct rescanned_strings {
+    std::string first, second;
+};
+}  // namespace
+
+template <>
+struct scn::scanner<rescanned_strings, char> {
+    template <typename ParseContext>
+    constexpr auto parse(ParseContext& pctx)
+        -> scn::scan_expected<typename ParseContext::iterator>
+    {
+        return pctx.begin();
+    }
+
+    template <typename Context>
+    auto scan(rescanned_strings& val, Context& ctx) const
+        -> scn::scan_expected<typename Context::iterator>
+    {
+        const auto saved = ctx.begin();
+        auto first = scn::scan<std::string, std::string>(ctx.range(), "{} {}");
+        if (!first) {
+            return scn::unexpected(first.error());
+        }
+
+        auto second = scn::scan<std::string, std::string>(
+            scn::ranges::subrange{saved, ctx.end()}, "{} {}");
+        if (!second) {
+            return scn::unexpected(second.error());
+        }
+        if (second->values() != first->values()) {
+            return scn::unexpected_scan_error(
+                scn::scan_error::invalid_scanned_value, "Rescan mismatch");
+        }
+        std::tie(val.first, val.second) = second->values();
+        return second->begin();
+    }
+};
+
+TEST(ScanBufferTest, NestedScanKeepsEnclosingIteratorsValid)
+{
+    const auto src = std::string(5000, 'a') + ' ' + std::string(4999, 'b');
+    auto deque = std::deque<char>{src.begin(), src.end()};
+
+    auto result = scn::scan<rescanned_strings>(deque, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().first, std::string(5000, 'a'));
+    EXPECT_EQ(result->value().second, std::string(4999, 'b'));
+}
+
+TEST(ScanBufferTest, NestedScanDoesntReleaseBoundedBuffer)
+{
+    const auto src = std::string(5000, 'a') + ' ' + std::string(4999, 'b');
+    chunked_buffer buf{src, 100};
+    buf.set_bounded_putback(true);
+
+    auto result = scn::scan<rescanned_strings>(buf.get(), "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value().first, std::string(5000, 'a'));
+    EXPECT_EQ(result->value().second, std::string(4999, 'b'));
+}
+
+#if !SCN_DISABLE_THREADS
+TEST(ScanBufferTest, ReadaheadFile)
+{
+    std::FILE* f = std::tmpfile();
+    ASSERT_NE(f, nullptr);
+    for (int i = 1; i <= 100000; ++i) {
+        std::fprintf(f, "%d ", i);
+    }
+    std::rewind(f);
+
+    {
+        scn::detail::scan_readahead_file_buffer buf{f, 4096};
+        buf.set_bounded_putback(true);
+
+        auto range = buf.get();
+        long long sum = 0;
+        int count = 0;
+        while (auto result = scn::scan<int>(range, "{}")) {
+            sum += result->value();
+            ++count;
+            range = result->range();
+        }
+        EXPECT_EQ(count, 100000);
+        EXPECT_EQ(sum, 5000050000LL);
+        EXPECT_LE(buf.putback_buffer().size(), 3u * 4096u);
+    }
+
+    std::fclose(f);
+}
+
+TEST(ScanBufferTest, ReadaheadFileRepositionsOnDestruction)
+{
+    std::FILE* f = std::tmpfile();
+    ASSERT_NE(f, nullptr);
+    std::fputs("123 456 rest", f);
+    std::rewind(f);
+
+    {
+        scn::detail::scan_readahead_file_buffer buf{f};
+        auto result = scn::scan<int, int>(buf.get(), "{} {}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->values(), std::make_tuple(123, 456));
+        EXPECT_EQ(buf.consumed(), 7);
+    }
+
+    char rest[16]{};
+    ASSERT_NE(std::fgets(rest, sizeof(rest), f), nullptr);
+    EXPECT_STREQ(rest, " rest");
+    std::fclose(f);
+}
+
+TEST(ScanBufferTest, ReadaheadFileEmpty)
+{
+    std::FILE* f = std::tmpfile();
+    ASSERT_NE(f, nullptr);
+    {
+        scn::detail::scan_readahead_file_buffer buf{f};
+        EXPECT_FALSE(scn::scan<int>(buf.get(), "{}"));
+        EXPECT_FALSE(buf.fill());
+    }
+    std::fclose(f);
+}
+#endif
+
+#if SCN_POSIX
+TEST(ScanBufferTest, FdFromPipe)
+{
+    int fds[2]{};
+    ASSERT_EQ(::pipe(fds), 0);
+
+    std::thread writer{[fd = fds[1]]() {
+        std::string data;
+        for (int i = 1; i <= 100000; ++i) {
+            data += std::to_string(i);
+            data += ' ';
+        }
+        std::size_t written = 0;
+        while (written < data.size()) {
+            auto n = ::write(fd, data.data() + written, data.size() - written);
+            if (n <= 0) {
+                break;
+            }
+            written += static_cast<std::size_t>(n);
+        }
+        ::close(fd);
+    }};
+
+    scn::detail::scan_fd_buffer buf{fds[0]};
+    auto range = buf.get();
+    long long sum = 0;
+    int count = 0;
+    while (auto result = scn::scan<int>(range, "{}")) {
+        sum += result->value();
+        ++count;
+        range = result->range();
+    }
+    writer.join();
+    ::close(fds[0]);
+
+    EXPECT_EQ(count, 100000);
+    EXPECT_EQ(sum, 5000050000LL);
+    EXPECT_EQ(buf.consumed(), range.begin().position());
+}
+
+TEST(ScanBufferTest, FdSyncTracksConsumed)
+{
+    const char* path = "scn_buffer_test_fd_sync.txt";
+    {
+        std::FILE* f = std::fopen(path, "wb");
+        ASSERT_NE(f, nullptr);
+        std::fputs("123 456 x", f);
+        std::fclose(f);
+    }
+
+    const int fd = ::open(path, O_RDONLY);
+    ASSERT_NE(fd, -1);
+    {
+        scn::detail::scan_fd_buffer buf{fd};
+        auto result = scn::scan<int>(buf.get(), "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value(), 123);
+        EXPECT_EQ(buf.consumed(), 3);
+
+        result = scn::scan<int>(result->range(), "{}");
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value(), 456);
+        EXPECT_EQ(buf.consumed(), 7);
+
+        // Failure: nothing consumed
+        auto failed = scn::scan<int>(result->range(), "{}");
+        EXPECT_FALSE(failed);
+        EXPECT_EQ(buf.consumed(), 7);
+    }
+
+    ::close(fd);
+    std::remove(path);
+}
+
+TEST(ScanBufferTest, PinnedFdBufferPointsToBlocks)
+{
+    int fds[2]{};
+    ASSERT_EQ(::pipe(fds), 0);
+
+    std::thread writer{[fd = fds[1]]() {
+        for (int i = 0; i < 20000; ++i) {
+            auto str = "word" + std::to_string(i) + '\n';
+            if (::write(fd, str.data(), str.size()) <= 0) {
+                break;
+            }
+        }
+        ::close(fd);
+    }};
+
+    std::vector<std::string_view> values;
+    scn::detail::scan_fd_buffer buf{fds[0]};
+    buf.set_bounded_putback(true);
+    buf.pin();
+    auto range = buf.get();
+    while (auto result = scn::scan<std::string_view>(range, "{}")) {
+        values.push_back(result->value());
+        range = result->range();
+    }
+    writer.join();
+    ::close(fds[0]);
+
+    ASSERT_EQ(values.size(), 20000u);
+    for (int i = 0; i < 20000; ++i) {
+        EXPECT_EQ(values[static_cast<std::size_t>(i)],
+                  "word" + std::to_string(i));
+    }
+    buf.unpin();
+}
+
+#if SCN_HAS_MEMORY_RESOURCE
+TEST(ScanBufferTest, UnpinFreesRetiredFdBlocks)
+{
+    int fds[2]{};
+    ASSERT_EQ(::pipe(fds), 0);
+
+    counting_resource resource;
+    {
+        scn::detail::scan_fd_buffer buf{fds[0]};
+        buf.set_memory_resource(&resource);
+        buf.pin();
+
+        // The first block is retired by the second fill, while pinned
+        ASSERT_EQ(::write(fds[1], "abc", 3), 3);
+        ASSERT_TRUE(buf.fill());
+        ASSERT_EQ(::write(fds[1], "def", 3), 3);
+        ASSERT_TRUE(buf.fill());
+
+        const auto pinned_bytes = resource.live_bytes;
+        buf.unpin();
+        EXPECT_GE(pinned_bytes - resource.live_bytes,
+                  scn::detail::scan_fd_buffer::min_block_size);
+    }
+    EXPECT_EQ(resource.live_bytes, 0u);
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+#endif
+#endif
@@ -0,0 +1,214 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/scan.h>
+#include <scn/xchar.h>
+
+#include <deque>
+
+TEST(CompiledFormatTest, Simple)
+{
+    auto fmt = scn::compile_format<int>("{}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan("42 rest", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 42);
+    EXPECT_STREQ(result->range().data(), " rest");
+}
+
+TEST(CompiledFormatTest, Reuse)
+{
+    auto fmt = scn::compile_format<int, std::string, double>("{} {} {:f}");
+    ASSERT_TRUE(fmt);
+
+    for (int i = 0; i < 3; ++i) {
+        auto source = std::to_string(i) + " abc 3.5";
+        auto result = scn::scan(source, *fmt);
+        ASSERT_TRUE(result);
+        auto [a, b, c] = result->values();
+        EXPECT_EQ(a, i);
+        EXPECT_EQ(b, "abc");
+        EXPECT_DOUBLE_EQ(c, 3.5);
+    }
+}
+
+TEST(CompiledFormatTest, SpecsAndLiterals)
+{
+    auto fmt = scn::compile_format<int, int>("x={:x} {{{:b}}}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan("x=ff {101}", *fmt);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 0xff);
+    EXPECT_EQ(b, 5);
+}
+
+TEST(CompiledFormatTest, ExplicitArgIds)
+{
+    auto fmt = scn::compile_format<int, int>("{1}:{0}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan("1:2", *fmt);
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, 1);
+}
+
+TEST(CompiledFormatTest, LiteralMismatch)
+{
+    auto fmt = scn::compile_format<int>("a{}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan("b42", *fmt);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
+
+TEST(CompiledFormatTest, InvalidRuntimeFormat)
+{
+    EXPECT_FALSE(scn::compile_format<int>(scn::runtime_format("{")));
+    EXPECT_FALSE(scn::compile_format<int>(scn::runtime_format("{} {}")));
+    EXPECT_FALSE((scn::compile_format<int, int>(scn::runtime_format("{}"))));
+    EXPECT_FALSE(scn::compile_format<int>(scn::runtime_format("{:s}")));
+}
+
+TEST(CompiledFormatTest, NonContiguousSource)
+{
+    auto fmt = scn::compile_format<int, int>("{}, {:d}");
+    ASSERT_TRUE(fmt);
+
+    auto source = std::deque<char>{'1', ',', ' ', '2', '3'};
+    auto result = scn::scan(source, *fmt);
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 23);
+}
+
+TEST(CompiledFormatTest, Wide)
+{
+    auto fmt = scn::compile_format<int, std::wstring>(L"{} {}");
+    ASSERT_TRUE(fmt);
+
+    auto result = scn::scan(L"42 foo", *fmt);
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 42);
+    EXPECT_EQ(b, L"foo");
+}
+
+TEST(CompiledFormatTest, CompileTimeFormat)
+{
+    auto result =
+        scn::scan<int, int, std::string>("1 ff abc", SCN_COMPILE("{} {:x} {}"));
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 0xff);
+    EXPECT_EQ(c, "abc");
+}
+
+TEST(CompiledFormatTest, CompileTimeFormatLiterals)
+{
+    auto result = scn::scan<int, int, double>(
+        "x=12,{34}  :5.5;rest", SCN_COMPILE("x={},{{{}}} :{};"));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view{result->range().data()}, "rest");
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, 12);
+    EXPECT_EQ(b, 34);
+    EXPECT_DOUBLE_EQ(c, 5.5);
+}
+
+TEST(CompiledFormatTest, CompileTimeFormatErrors)
+{
+    auto mismatch = scn::scan<int>("b42", SCN_COMPILE("a{}"));
+    ASSERT_FALSE(mismatch);
+    EXPECT_EQ(mismatch.error().code(), scn::scan_error::invalid_format_string);
+
+    auto eof = scn::scan<int>("42", SCN_COMPILE("{}abc"));
+    ASSERT_FALSE(eof);
+    EXPECT_EQ(eof.error().code(), scn::scan_error::invalid_format_string);
+
+    auto invalid = scn::scan<int>("abc", SCN_COMPILE("{}"));
+    ASSERT_FALSE(invalid);
+    EXPECT_EQ(invalid.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
+TEST(CompiledFormatTest, CompileTimeFormatExplicitArgIds)
+{
+    auto result = scn::scan<int, std::string_view>("abc 2",
+                                                   SCN_COMPILE("{1} {0}"));
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, "abc");
+}
+
+TEST(CompiledFormatTest, CompileTimeFormatNonContiguousSource)
+{
+    auto source = std::deque<char>{'1', ',', ' ', '2', '3'};
+    auto result = scn::scan<int, int>(source, SCN_COMPILE("{}, {:d}"));
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 23);
+}
+
+namespace {
+struct compiled_int_wrapper {
+    int value{};
+};
+}  // namespace
+
+template <>
+struct scn::scanner<compiled_int_wrapper, char> : scn::scanner<int, char> {
+    template <typename Context>
+    scn::scan_expected<typename Context::iterator> scan(
+        compiled_int_wrapper& val,
+        Context& ctx) const
+    {
+        return scn::scanner<int, char>::scan(val.value, ctx);
+    }
+};
+
+TEST(CompiledFormatTest, CompileTimeFormatCustomType)
+{
+    auto result = scn::scan<compiled_int_wrapper, int>("ff 3",
+                                                       SCN_COMPILE("{:x} {}"));
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a.value, 0xff);
+    EXPECT_EQ(b, 3);
+}
+
+TEST(CompiledFormatTest, CompileTimeFormatWide)
+{
+    auto result =
+        scn::scan<int, std::wstring>(L"42 foo", SCN_COMPILE(L"{} {}"));
+    ASSERT_TRUE(result);
+    auto [a, b] = result->values();
+    EXPECT_EQ(a, 42);
+    EXPECT_EQ(b, L"foo");
+}
@@ -19,6 +19,13 @@
 
 #include <scn/scan.h>
 
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
 TEST(FloatTest, FloatWithSuffix)
 {
     auto result = scn::scan<double>("scn::scan for string_view: 0.0075ms",
@@ -32,3 +39,76 @@ TEST(FloatTest, FloatWithDoubleSign) {
     auto result = scn::scan<double>("--4", "{}");
     ASSERT_FALSE(result);
 }
+
+#if !SCN_DISABLE_TYPE_LONG_DOUBLE
+TEST(FloatTest, LongDoubleFromMultipleThreads)
+{
+    const std::string global_locale = std::setlocale(LC_NUMERIC, nullptr);
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+    for (std::size_t t = 0; t < failures.size(); ++t) {
+        threads.emplace_back([&failures, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                auto result = scn::scan<long double, long double>(
+                    "1.25 0x1.8p1", "{} {:a}");
+                if (!result || std::get<0>(result->values()) != 1.25L ||
+                    std::get<1>(result->values()) != 3.0L) {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    for (auto f : failures) {
+        EXPECT_EQ(f, 0);
+    }
+    EXPECT_EQ(global_locale, std::setlocale(LC_NUMERIC, nullptr));
+}
+
+TEST(FloatTest, LongDoubleMatchesStrtold)
+{
+    const char* inputs[] = {"1.25",
+                            "0.1",
+                            "3.141592653589793238",
+                            "3.14159265358979323846264338327950288",
+                            "123456789012345678901234567890",
+                            "18446744073709551615",
+                            "1e27",
+                            "1e28",
+                            "1e30",
+                            "1e-27",
+                            "1e-28",
+                            "1e-49",
+                            "0.000000000000000000000000001234",
+                            "1.7976931348623157e308",
+                            "12345678901234567890123e-10",
+                            "1e300",
+                            "0.0e12345"};
+    for (const char* input : inputs) {
+        SCOPED_TRACE(input);
+        const long double expected = std::strtold(input, nullptr);
+
+        auto result = scn::scan_value<long double>(std::string_view{input});
+        ASSERT_TRUE(result);
+        EXPECT_TRUE(result->range().empty());
+        const long double value = result->value();
+        EXPECT_EQ(std::memcmp(&value, &expected,
+                              std::numeric_limits<long double>::digits == 64
+                                  ? 10
+                                  : sizeof(long double)),
+                  0);
+    }
+}
+
+TEST(FloatTest, LongDoubleWithIncompleteExponent)
+{
+    auto result = scn::scan_value<long double>("12.5e+x");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 12.5L);
+    EXPECT_STREQ(result->range().data(), "e+x");
+}
+#endif
@@ -0,0 +1,190 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "wrapped_gtest.h"
+
+#include <scn/scan.h>
+#include <scn/xchar.h>
+
+#include <thread>
+#include <vector>
+
+namespace {
+class FormatCacheTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        scn::set_format_cache_capacity(4);
+    }
+    void TearDown() override
+    {
+        scn::set_format_cache_capacity(0);
+    }
+};
+}  // namespace
+
+TEST_F(FormatCacheTest, HitsAndMisses)
+{
+    const std::string format = "a={} b={:x}";
+    for (int i = 0; i < 3; ++i) {
+        auto result =
+            scn::scan<int, int>("a=1 b=ff", scn::runtime_format(format));
+        ASSERT_TRUE(result);
+        auto [a, b] = result->values();
+        EXPECT_EQ(a, 1);
+        EXPECT_EQ(b, 0xff);
+    }
+
+    const auto stats = scn::get_format_cache_stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.size, 1);
+    EXPECT_EQ(stats.capacity, 4);
+}
+
+TEST_F(FormatCacheTest, Disabled)
+{
+    scn::set_format_cache_capacity(0);
+
+    const std::string format = "a={}";
+    for (int i = 0; i < 2; ++i) {
+        auto result = scn::scan<int>("a=1", scn::runtime_format(format));
+        ASSERT_TRUE(result);
+        EXPECT_EQ(result->value(), 1);
+    }
+
+    const auto stats = scn::get_format_cache_stats();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.misses, 0);
+    EXPECT_EQ(stats.size, 0);
+}
+
+TEST_F(FormatCacheTest, ChangedFormatAtSameAddress)
+{
+    std::string format = "a={}";
+    ASSERT_TRUE(scn::scan<int>("a=1", scn::runtime_format(format)));
+
+    format[0] = 'b';
+    auto result = scn::scan<int>("b=2", scn::runtime_format(format));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), 2);
+
+    auto stats = scn::get_format_cache_stats();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.size, 1);
+}
+
+TEST_F(FormatCacheTest, DifferentArgumentTypes)
+{
+    const std::string format = "a={}";
+    ASSERT_TRUE(scn::scan<int>("a=1", scn::runtime_format(format)));
+
+    auto result = scn::scan<std::string>("a=abc", scn::runtime_format(format));
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "abc");
+    EXPECT_EQ(scn::get_format_cache_stats().hits, 0);
+}
+
+TEST_F(FormatCacheTest, InvalidFormat)
+{
+    const std::string format = "a={";
+    for (int i = 0; i < 2; ++i) {
+        auto result = scn::scan<int>("a=1", scn::runtime_format(format));
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().code(),
+                  scn::scan_error::invalid_format_string);
+    }
+    EXPECT_EQ(scn::get_format_cache_stats().size, 0);
+}
+
+TEST_F(FormatCacheTest, InvalidSpecsForType)
+{
+    const std::string format = "a={:s}";
+    for (int i = 0; i < 2; ++i) {
+        auto result = scn::scan<int>("a=1", scn::runtime_format(format));
+        ASSERT_FALSE(result);
+        EXPECT_EQ(result.error().code(),
+                  scn::scan_error::invalid_format_string);
+    }
+}
+
+TEST_F(FormatCacheTest, LeastRecentlyUsedIsEvicted)
+{
+    scn::set_format_cache_capacity(2);
+
+    const std::string first = "1:{}", second = "2:{}", third = "3:{}";
+    ASSERT_TRUE(scn::scan<int>("1:0", scn::runtime_format(first)));
+    ASSERT_TRUE(scn::scan<int>("2:0", scn::runtime_format(second)));
+    ASSERT_TRUE(scn::scan<int>("1:0", scn::runtime_format(first)));
+    ASSERT_TRUE(scn::scan<int>("3:0", scn::runtime_format(third)));
+
+    // `second` was evicted, `first` was not
+    ASSERT_TRUE(scn::scan<int>("1:0", scn::runtime_format(first)));
+    ASSERT_TRUE(scn::scan<int>("2:0", scn::runtime_format(second)));
+
+    const auto stats = scn::get_format_cache_stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 4);
+    EXPECT_EQ(stats.size, 2);
+}
+
+TEST_F(FormatCacheTest, Wide)
+{
+    const std::wstring format = L"a={} b={}";
+    for (int i = 0; i < 2; ++i) {
+        auto result = scn::scan<int, std::wstring>(
+            L"a=1 b=c", scn::runtime_format(format));
+        ASSERT_TRUE(result);
+        auto [a, b] = result->values();
+        EXPECT_EQ(a, 1);
+        EXPECT_EQ(b, L"c");
+    }
+    EXPECT_EQ(scn::get_format_cache_stats().hits, 1);
+}
+
+#if !SCN_DISABLE_THREADS
+TEST_F(FormatCacheTest, ConcurrentScans)
+{
+    const std::string formats[] = {"a={} b={}", "b={} a={}", "c={} d={}"};
+    constexpr int iterations = 1000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&formats]() {
+            for (int i = 0; i < iterations; ++i) {
+                const auto& format = formats[i % 3];
+                auto result = scn::scan<int, int>(
+                    format.substr(0, 2) + "1 " + format.substr(5, 2) + "2",
+                    scn::runtime_format(format));
+                if (!result || result->values() != std::make_tuple(1, 2)) {
+                    ADD_FAILURE() << "Failed to scan with " << format;
+                    return;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    const auto stats = scn::get_format_cache_stats();
+    EXPECT_EQ(stats.hits + stats.misses, 4u * iterations);
+    EXPECT_GE(stats.misses, 3u);
+    EXPECT_EQ(stats.size, 3);
+}
+#endif
@@ -20,6 +20,8 @@
 #include <scn/scan.h>
 #include <scn/xchar.h>
 
+#include <deque>
+
 TEST(FormatStringTest, ConstructFromLiteral)
 {
     scn::scan_format_string<std::string_view, int> str{"{}"};
@@ -253,6 +255,140 @@ TEST(FormatStringTest, LongFormatString4)
     EXPECT_EQ(result->value(), '0');
 }
 
+TEST(FormatStringTest, LiteralRuns)
+{
+    auto result = scn::scan<int, std::string>(
+        "timestamp=123  level=warn", "timestamp={} level={}");
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    auto [ts, level] = result->values();
+    EXPECT_EQ(ts, 123);
+    EXPECT_EQ(level, "warn");
+}
+TEST(FormatStringTest, LiteralRunMismatch)
+{
+    auto result = scn::scan<int>("timestamp=123", "timestanp={}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+    EXPECT_STREQ(result.error().msg(),
+                 "Unexpected literal character in source");
+}
+TEST(FormatStringTest, LiteralRunUnexpectedEnd)
+{
+    auto result = scn::scan<int>("time", "timestamp={}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+    EXPECT_STREQ(result.error().msg(), "Unexpected end of source");
+}
+
+TEST(FormatStringTest, SpaceDelimitedArguments)
+{
+    auto result =
+        scn::scan<int, std::string, double>("1 \n abc\t2.5 rest", "{} {} {}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view{result->range().data()}, " rest");
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, "abc");
+    EXPECT_DOUBLE_EQ(c, 2.5);
+}
+TEST(FormatStringTest, CommaDelimitedArguments)
+{
+    auto result = scn::scan<int, int, int>("1,2, 3", "{},{},{}");
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 2);
+    EXPECT_EQ(c, 3);
+}
+TEST(FormatStringTest, CommaDelimitedArgumentsMismatch)
+{
+    auto mismatch = scn::scan<int, int>("1;2", "{},{}");
+    ASSERT_FALSE(mismatch);
+    EXPECT_EQ(mismatch.error().code(), scn::scan_error::invalid_format_string);
+
+    auto eof = scn::scan<int, int>("1", "{},{}");
+    ASSERT_FALSE(eof);
+    EXPECT_EQ(eof.error().code(), scn::scan_error::invalid_format_string);
+}
+TEST(FormatStringTest, DelimitedArgumentsNonContiguous)
+{
+    auto source = std::deque<char>{'1', ',', '2', '3', ',', 'a', 'b'};
+    auto result = scn::scan<int, int, std::string>(source, "{},{},{}");
+    ASSERT_TRUE(result);
+    auto [a, b, c] = result->values();
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, 23);
+    EXPECT_EQ(c, "ab");
+}
+
+namespace {
+template <std::size_t... Is>
+auto scan_many_ints(std::string_view source,
+                    std::string_view format,
+                    std::index_sequence<Is...>)
+{
+    return scn::scan<decltype(Is, int{})...>(source,
+                                             scn::runtime_format(format));
+}
+
+std::string make_many_ints_source(int count)
+{
+    std::string source{"x"};
+    for (int i = 0; i < count; ++i) {
+        source += " " + std::to_string(i);
+    }
+    return source;
+}
+}  // namespace
+
+TEST(FormatStringTest, ManyArgumentsInOrder)
+{
+    std::string format{"x"};
+    for (int i = 0; i < 80; ++i) {
+        format += " {}";
+    }
+
+    auto result = scan_many_ints(make_many_ints_source(80), format,
+                                 std::make_index_sequence<80>{});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<0>(result->values()), 0);
+    EXPECT_EQ(std::get<79>(result->values()), 79);
+}
+TEST(FormatStringTest, ManyArgumentsOutOfOrder)
+{
+    std::string format{"x"};
+    for (int i = 0; i < 70; ++i) {
+        format += " {" + std::to_string(i < 3 ? i : 72 - i) + "}";
+    }
+
+    auto result = scan_many_ints(make_many_ints_source(70), format,
+                                 std::make_index_sequence<70>{});
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::get<2>(result->values()), 2);
+    EXPECT_EQ(std::get<69>(result->values()), 3);
+    EXPECT_EQ(std::get<3>(result->values()), 69);
+}
+TEST(FormatStringTest, ManyArgumentsNotExhausted)
+{
+    std::string format{"x"};
+    for (int i = 0; i < 64; ++i) {
+        format += " {" + std::to_string(i) + "}";
+    }
+
+    auto result = scan_many_ints(make_many_ints_source(65), format,
+                                 std::make_index_sequence<65>{});
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
+TEST(FormatStringTest, ArgumentScannedTwice)
+{
+    auto result = scn::scan<int, int>("1 2", scn::runtime_format("{1} {1}"));
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_format_string);
+}
+
 TEST(FormatStringTest, MatchLiteralInvalidEncoding)
 {
     auto result =
@@ -100,6 +100,37 @@ TEST(ContiguousRangeFactoryTest, MakeStringViewIntoAllocatedString)
     EXPECT_EQ(crf.make_into_allocated_string(), std::string_view{"mno"});
     EXPECT_TRUE(crf.stores_allocated_string());
 }
+TEST(ContiguousRangeFactoryTest, SegmentedRangeIntoAllocatedString)
+{
+    const std::string_view segments[] = {"ab", "cd"};
+    scn::detail::scan_segmented_buffer buf{segments, 2};
+    auto first = buf.get().begin();
+    auto last = scn::ranges::next(first, 4);
+
+    scn::impl::contiguous_range_factory crf{scn::ranges::subrange{first, last}};
+    EXPECT_TRUE(crf.stores_allocated_string());
+    EXPECT_TRUE(crf.owns_view());
+    EXPECT_EQ(crf.view(), "abcd");
+}
+#if SCN_HAS_MEMORY_RESOURCE
+TEST(ContiguousRangeFactoryTest, SegmentedRangeIntoMemoryResource)
+{
+    std::pmr::monotonic_buffer_resource resource;
+    const std::string_view segments[] = {"ab", "cd"};
+    scn::detail::scan_segmented_buffer buf{segments, 2};
+    buf.set_memory_resource(&resource);
+    auto first = buf.get().begin();
+    auto last = scn::ranges::next(first, 4);
+
+    scn::impl::contiguous_range_factory crf{scn::ranges::subrange{first, last}};
+    EXPECT_FALSE(crf.stores_allocated_string());
+    EXPECT_TRUE(crf.owns_view());
+    EXPECT_EQ(crf.view(), "abcd");
+
+    EXPECT_EQ(crf.make_into_allocated_string(), std::string{"abcd"});
+    EXPECT_TRUE(crf.stores_allocated_string());
+}
+#endif
 
 TEST(MakeContiguousBufferTest, StringViewIntoStringViewWrapper)
 {
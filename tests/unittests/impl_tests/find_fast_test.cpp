@@ -131,6 +131,44 @@ TEST(FindClassicSpaceNarrowFastTest, WonkyInput4)
     EXPECT_EQ(scn::impl::find_classic_space_narrow_fast(src), src.end());
 }
 
+TEST(FindClassicSpaceNarrowFastTest, SpaceAtEveryOffset)
+{
+    for (std::size_t i = 0; i < 100; ++i) {
+        std::string src(100, 'a');
+        src[i] = (i % 2 == 0) ? ' ' : '\v';
+        auto sv = std::string_view{src};
+        EXPECT_EQ(scn::impl::find_classic_space_narrow_fast(sv),
+                  sv.begin() + static_cast<std::ptrdiff_t>(i))
+            << "i: " << i;
+    }
+}
+TEST(FindClassicSpaceNarrowFastTest, NonAsciiInLongInput)
+{
+    // U+00E4 (not a space), followed by U+2028 (line separator, a space)
+    auto src =
+        "abcdefghijklmnop\xc3\xa4qrstuvwxyz0123456789\xe2\x80\xa8"
+        "abc "sv;
+    EXPECT_EQ(scn::detail::to_address(
+                  scn::impl::find_classic_space_narrow_fast(src)),
+              src.data() + 38);
+}
+
+TEST(FindClassicNonspaceNarrowFastTest, LongWhitespaceInput)
+{
+    auto src =
+        "  \t\n\r\v\f                                     \xc2\x85 \n\n  x"sv;
+    EXPECT_EQ(scn::detail::to_address(
+                  scn::impl::find_classic_nonspace_narrow_fast(src)),
+              src.data() + src.size() - 1);
+}
+TEST(FindClassicNonspaceNarrowFastTest, NonAsciiNonspaceInLongInput)
+{
+    auto src = "                                   \xc3\xa4"sv;
+    EXPECT_EQ(scn::detail::to_address(
+                  scn::impl::find_classic_nonspace_narrow_fast(src)),
+              src.data() + 35);
+}
+
 TEST(FindClassicNonspaceNarrowFastTest, EmojiInput)
 {
     auto input = "😂\n"sv;
@@ -157,3 +195,30 @@ TEST(FindClassicNonspaceNarrowFastTest, EmojiInput)
             scn::impl::find_classic_nonspace_narrow_fast(input.substr(4))),
         input.data() + 5);
 }
+
+TEST(FindNondecimalDigitNarrowFastTest, ShortInput)
+{
+    auto src = "123a"sv;
+    EXPECT_EQ(scn::impl::find_nondecimal_digit_narrow_fast(src),
+              src.begin() + 3);
+}
+TEST(FindNondecimalDigitNarrowFastTest, OnlyDigits)
+{
+    auto src = "1234567890123456789012345678901234567890"sv;
+    EXPECT_EQ(scn::impl::find_nondecimal_digit_narrow_fast(src), src.end());
+}
+TEST(FindNondecimalDigitNarrowFastTest, NondigitAtEveryOffset)
+{
+    // Characters right outside of '0'-'9', and a non-ASCII one
+    const char nondigits[] = {'/', ':', ' ', '\x80', '\xb0', '\xff'};
+    for (char nondigit : nondigits) {
+        for (std::size_t i = 0; i < 70; ++i) {
+            std::string src(70, '5');
+            src[i] = nondigit;
+            auto sv = std::string_view{src};
+            EXPECT_EQ(scn::impl::find_nondecimal_digit_narrow_fast(sv),
+                      sv.begin() + static_cast<std::ptrdiff_t>(i))
+                << "i: " << i << ", ch: " << static_cast<int>(nondigit);
+        }
+    }
+}
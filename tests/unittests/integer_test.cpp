@@ -20,6 +20,7 @@
 #include <scn/scan.h>
 
 #include <deque>
+#include <vector>
 
 namespace {
 template <typename... Args>
@@ -115,6 +116,44 @@ TEST(IntegerTest, LeadingZeroesInHexadecimalWithPrefix)
     EXPECT_EQ(val, 0x100);
 }
 
+TEST(IntegerTest, LeadingZeroesInDefault)
+{
+    auto [result, val] = do_test<long long>(
+        "0000000000000000000009223372036854775807", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(val, 9223372036854775807);
+}
+TEST(IntegerTest, NegativeMinInDefault)
+{
+    auto [result, val] = do_test<long long>("-9223372036854775808", "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(val, std::numeric_limits<long long>::min());
+}
+TEST(IntegerTest, OverflowInDefault)
+{
+    auto result = scn::scan<long long>("9223372036854775808", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::value_out_of_range);
+}
+TEST(IntegerTest, OnlySignInDefault)
+{
+    auto result = scn::scan<int>("+", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+TEST(IntegerTest, MinusSignForUnsignedInDefault)
+{
+    auto result = scn::scan<unsigned>("-1", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+TEST(IntegerTest, SignFollowedByNonDigitInDefault)
+{
+    auto result = scn::scan<int>("-a", "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::invalid_scanned_value);
+}
+
 TEST(IntegerTest, Pointer)
 {
     char source_buf[64]{};
@@ -556,6 +595,101 @@ TEST(ScanIntTest, Empty)
     EXPECT_EQ(result.error().code(), scn::scan_error::end_of_range);
 }
 
+TEST(ScanIntArrayTest, Simple)
+{
+    std::vector<int> values;
+    auto result =
+        scn::scan_int_array<int>("1,-2,+3,0", ',', std::back_inserter(values));
+    EXPECT_TRUE(result.error);
+    EXPECT_EQ(result.count, 4);
+    EXPECT_TRUE(result.range.empty());
+    EXPECT_EQ(values, (std::vector<int>{1, -2, 3, 0}));
+}
+TEST(ScanIntArrayTest, Empty)
+{
+    std::vector<int> values;
+    auto result = scn::scan_int_array<int>("", ',', std::back_inserter(values));
+    EXPECT_TRUE(result.error);
+    EXPECT_EQ(result.count, 0);
+    EXPECT_TRUE(values.empty());
+}
+TEST(ScanIntArrayTest, TrailingDelimiter)
+{
+    std::vector<int> values;
+    auto result =
+        scn::scan_int_array<int>("1 2 3 ", ' ', std::back_inserter(values));
+    EXPECT_TRUE(result.error);
+    EXPECT_TRUE(result.range.empty());
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+}
+TEST(ScanIntArrayTest, StopsAtOtherCharacter)
+{
+    std::vector<int> values;
+    auto result =
+        scn::scan_int_array<int>("1,2\n3,4", ',', std::back_inserter(values));
+    EXPECT_TRUE(result.error);
+    EXPECT_EQ(result.count, 2);
+    EXPECT_EQ(std::string_view(result.range.data(), result.range.size()),
+              "\n3,4");
+}
+TEST(ScanIntArrayTest, InvalidValue)
+{
+    std::vector<int> values;
+    auto result =
+        scn::scan_int_array<int>("1,,2", ',', std::back_inserter(values));
+    ASSERT_FALSE(result.error);
+    EXPECT_EQ(result.error.code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(result.count, 1);
+    EXPECT_EQ(std::string_view(result.range.data(), result.range.size()),
+              ",2");
+}
+TEST(ScanIntArrayTest, Overflow)
+{
+    std::vector<short> values;
+    auto result = scn::scan_int_array<short>("1,-32768,32768,2", ',',
+                                             std::back_inserter(values));
+    ASSERT_FALSE(result.error);
+    EXPECT_EQ(result.error.code(), scn::scan_error::value_out_of_range);
+    EXPECT_EQ(values, (std::vector<short>{1, -32768}));
+    EXPECT_EQ(std::string_view(result.range.data(), result.range.size()),
+              "32768,2");
+}
+TEST(ScanIntArrayTest, MinusSignForUnsigned)
+{
+    std::vector<unsigned> values;
+    auto result =
+        scn::scan_int_array<unsigned>("1,-2", ',', std::back_inserter(values));
+    ASSERT_FALSE(result.error);
+    EXPECT_EQ(result.error.code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(result.count, 1);
+}
+TEST(ScanIntArrayTest, LongInput)
+{
+    std::string input;
+    std::vector<long long> expected;
+    for (long long i = 0; i < 1000; ++i) {
+        expected.push_back(i * 1'000'000'007 - 500'000'000'000);
+        input += std::to_string(expected.back());
+        input += ';';
+    }
+
+    std::vector<long long> values;
+    auto result = scn::scan_int_array<long long>(input, ';',
+                                                 std::back_inserter(values));
+    EXPECT_TRUE(result.error);
+    EXPECT_EQ(result.count, 1000);
+    EXPECT_TRUE(result.range.empty());
+    EXPECT_EQ(values, expected);
+}
+TEST(ScanIntArrayTest, RawPointerOutput)
+{
+    int values[3]{};
+    auto result = scn::scan_int_array<int>("7|8|9", '|', values);
+    EXPECT_TRUE(result.error);
+    EXPECT_EQ(result.out, values + 3);
+    EXPECT_EQ(values[2], 9);
+}
+
 #if !SCN_IS_BIG_ENDIAN
 TEST(ScanIntExhaustiveValidTest, Simple)
 {
@@ -249,3 +249,65 @@ TEST(ScanTest, DoubleNewline2)
     EXPECT_EQ(b, 2);
     EXPECT_EQ(res->begin(), res->end());
 }
+
+TEST(ScanTest, ScanAll)
+{
+    std::vector<int> values;
+    auto res = scn::scan_all<int>("1 2\n3 ", "{}", values);
+    EXPECT_TRUE(res.error);
+    EXPECT_EQ(res.count, 3);
+    EXPECT_TRUE(res.range.empty());
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+}
+TEST(ScanTest, ScanAllWithLiterals)
+{
+    std::vector<int> values;
+    auto res = scn::scan_all<int>("1, 2, 3,", "{},", values);
+    EXPECT_TRUE(res.error);
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+}
+TEST(ScanTest, ScanAllError)
+{
+    std::vector<int> values;
+    auto res = scn::scan_all<int>("1 2 x 3", "{}", values);
+    EXPECT_FALSE(res.error);
+    EXPECT_EQ(res.error.code(), scn::scan_error::invalid_scanned_value);
+    EXPECT_EQ(res.count, 2);
+    EXPECT_STREQ(res.range.data(), " x 3");
+    EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+TEST(ScanTest, ScanAllOutputIterator)
+{
+    std::string_view values[3]{};
+    auto res = scn::scan_all<std::string_view>("a bc d", "{}", values);
+    EXPECT_TRUE(res.error);
+    EXPECT_EQ(res.out, values + 3);
+    EXPECT_EQ(values[0], "a");
+    EXPECT_EQ(values[1], "bc");
+    EXPECT_EQ(values[2], "d");
+}
+
+TEST(ScanTest, ScanColumns)
+{
+    std::vector<int> ids;
+    std::vector<double> prices;
+    std::vector<std::string_view> names;
+    auto res = scn::scan_columns<int, double, std::string_view>(
+        "1 2.5 foo\n2 3.75 bar\n", "{} {} {}", ids, prices, names);
+    EXPECT_TRUE(res.error);
+    EXPECT_EQ(res.count, 2);
+    EXPECT_TRUE(res.range.empty());
+    EXPECT_EQ(ids, (std::vector<int>{1, 2}));
+    EXPECT_EQ(prices, (std::vector<double>{2.5, 3.75}));
+    EXPECT_EQ(names, (std::vector<std::string_view>{"foo", "bar"}));
+}
+TEST(ScanTest, ScanColumnsIncompleteRecord)
+{
+    std::vector<int> a, b;
+    auto res = scn::scan_columns<int, int>("1,2\n3,x\n", "{},{}", a, b);
+    EXPECT_FALSE(res.error);
+    EXPECT_EQ(res.count, 1);
+    EXPECT_STREQ(res.range.data(), "\n3,x\n");
+    EXPECT_EQ(a, (std::vector<int>{1}));
+    EXPECT_EQ(b, (std::vector<int>{2}));
+}
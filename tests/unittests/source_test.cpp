@@ -102,3 +102,112 @@ TEST(SourceTest, SourceIsStringRvalue)
         std::is_same_v<decltype(result),
                        scan_result_helper<scn::ranges::dangling, int, double>>);
 }
+
+namespace {
+struct temporary_file {
+    temporary_file(const char* name, std::string_view contents) : path(name)
+    {
+        std::FILE* f = std::fopen(path, "wb");
+        if (f) {
+            std::fwrite(contents.data(), 1, contents.size(), f);
+            std::fclose(f);
+        }
+    }
+    ~temporary_file()
+    {
+        std::remove(path);
+    }
+
+    const char* path;
+};
+}  // namespace
+
+TEST(SourceTest, SourceIsMappedFile)
+{
+    temporary_file tmp{"scn_source_test_mapped_file.txt", "123 foo 3.14"};
+    auto file = scn::mapped_file{tmp.path};
+    ASSERT_TRUE(file.valid());
+#if SCN_POSIX
+    EXPECT_TRUE(file.is_mapped());
+#endif
+    EXPECT_EQ(file.view(), "123 foo 3.14");
+
+    auto result =
+        scn::scan<int, std::string_view, double>(file, "{} {} {}");
+    static_assert(std::is_same_v<
+                  decltype(result),
+                  scan_result_helper<const char*, int, std::string_view,
+                                     double>>);
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result->range().empty());
+    auto [i, s, d] = result->values();
+    EXPECT_EQ(i, 123);
+    EXPECT_EQ(s, "foo");
+    EXPECT_EQ(s.data(), file.data() + 4);
+    EXPECT_DOUBLE_EQ(d, 3.14);
+}
+
+TEST(SourceTest, MappedFileContinueFromResult)
+{
+    temporary_file tmp{"scn_source_test_mapped_file_continue.txt",
+                       "1 2 3 4 5"};
+    auto file = scn::mapped_file{tmp.path};
+    ASSERT_TRUE(file);
+
+    auto input = scn::ranges::subrange{file.begin(), file.end()};
+    int sum = 0;
+    while (auto result = scn::scan<int>(input, "{}")) {
+        sum += result->value();
+        input = result->range();
+    }
+    EXPECT_EQ(sum, 15);
+}
+
+TEST(SourceTest, MappedFileEmpty)
+{
+    temporary_file tmp{"scn_source_test_mapped_file_empty.txt", ""};
+    auto file = scn::mapped_file{tmp.path};
+    ASSERT_TRUE(file.valid());
+    EXPECT_TRUE(file.empty());
+
+    auto result = scn::scan<int>(file, "{}");
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error().code(), scn::scan_error::end_of_range);
+}
+
+TEST(SourceTest, MappedFileMissing)
+{
+    auto file = scn::mapped_file{"scn_source_test_does_not_exist.txt"};
+    EXPECT_FALSE(file.valid());
+    EXPECT_TRUE(file.empty());
+}
+
+TEST(SourceTest, MappedFileMove)
+{
+    temporary_file tmp{"scn_source_test_mapped_file_move.txt", "42"};
+    auto file = scn::mapped_file{tmp.path};
+    ASSERT_TRUE(file.valid());
+
+    auto other = std::move(file);
+    EXPECT_FALSE(file.valid());
+    ASSERT_TRUE(other.valid());
+    EXPECT_EQ(other.view(), "42");
+
+    file = std::move(other);
+    ASSERT_TRUE(file.valid());
+    EXPECT_EQ(file.view(), "42");
+}
+
+#if defined(__linux__)
+TEST(SourceTest, MappedFileReadsProcfs)
+{
+    // procfs files report a size of zero, and can't be mapped
+    auto file = scn::mapped_file{"/proc/self/stat"};
+    ASSERT_TRUE(file.valid());
+    EXPECT_FALSE(file.is_mapped());
+
+    auto result = scn::scan<int>(file, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_GT(result->value(), 0);
+}
+#endif
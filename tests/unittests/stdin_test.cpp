@@ -81,3 +81,31 @@ TEST(Stdin, Test)
     EXPECT_EQ(read_scn<int>(), std::nullopt);
     EXPECT_THAT(read_cin<std::string>(), Optional("ccc"s));
 }
+
+TEST(Stdin, Reader)
+{
+    using namespace std::string_literals;
+
+    auto& reader = scn::stdin_reader::get();
+    EXPECT_EQ(&reader, &scn::stdin_reader::get());
+
+    auto i = reader.input<int>("{}");
+    ASSERT_TRUE(i);
+    EXPECT_EQ(i->value(), 106);
+
+    // Failure: nothing consumed
+    EXPECT_FALSE((reader.input<int, int>("{} {}")));
+
+    reader.flush();
+    EXPECT_THAT(read_scanf<int>(), Optional(107));
+
+    auto s = reader.input<std::string>("{}");
+    ASSERT_TRUE(s);
+    EXPECT_EQ(s->value(), "x");
+    i = reader.input<int>("{}");
+    ASSERT_TRUE(i);
+    EXPECT_EQ(i->value(), 108);
+
+    reader.flush();
+    EXPECT_THAT(read_cin<std::string>(), Optional("eee"s));
+}
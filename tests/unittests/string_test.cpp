@@ -20,6 +20,8 @@
 
 #include "wrapped_gtest.h"
 
+#include <deque>
+
 TEST(StringTest, DefaultNarrowStringFromNarrowSource)
 {
     auto result = scn::scan<std::string>("abc def", "{}");
@@ -219,3 +221,41 @@ TEST(StringTest, RecoveryFromInvalidEncoding)
     EXPECT_EQ(result->begin(), source.end() - 1);
 #endif
 }
+
+#if SCN_HAS_MEMORY_RESOURCE
+TEST(StringTest, PmrString)
+{
+    char storage[256]{};
+    std::pmr::monotonic_buffer_resource arena{
+        storage, sizeof(storage), std::pmr::null_memory_resource()};
+
+    auto result = scn::scan<std::pmr::string, int>(
+        "a_string_longer_than_the_small_buffer 42", "{} {}",
+        {std::pmr::string{&arena}, 0});
+    ASSERT_TRUE(result);
+    auto& [str, i] = result->values();
+    EXPECT_EQ(str, "a_string_longer_than_the_small_buffer");
+    EXPECT_EQ(str.get_allocator().resource(), &arena);
+    EXPECT_EQ(i, 42);
+}
+
+TEST(StringTest, PmrStringWithCharacterSet)
+{
+    auto result = scn::scan<std::pmr::string>("abc123", "{:[a-z]}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), "abc");
+    EXPECT_STREQ(result->begin(), "123");
+}
+
+TEST(StringTest, PmrStringFromNonContiguousSource)
+{
+    std::deque<char> source;
+    const auto word = std::string(200, 'a');
+    source.insert(source.end(), word.begin(), word.end());
+    source.push_back(' ');
+
+    auto result = scn::scan<std::pmr::string>(source, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_EQ(std::string_view{result->value()}, word);
+}
+#endif